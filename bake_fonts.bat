@@ -0,0 +1 @@
+bin\font_baker.exe "resources\Kenney Pixel.ttf" "resources\Kenney Pixel.fontbin" --sdf
\ No newline at end of file
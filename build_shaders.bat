@@ -1,2 +1,3 @@
 tools\sokol-shdc.exe --input shaders\quad.glsl --output src\gen\quad.glsl.h --slang glsl410:glsl300es
-tools\sokol-shdc.exe --input shaders\quad_uv.glsl --output src\gen\quad_uv.glsl.h --slang glsl410:glsl300es
\ No newline at end of file
+tools\sokol-shdc.exe --input shaders\quad_uv.glsl --output src\gen\quad_uv.glsl.h --slang glsl410:glsl300es
+tools\sokol-shdc.exe --input shaders\post.glsl --output src\gen\post.glsl.h --slang glsl410:glsl300es
\ No newline at end of file
@@ -0,0 +1,130 @@
+
+/* fullscreen triangle, no vertex buffer needed */
+@vs post_vs
+out vec2 uv;
+
+void main() {
+    vec2 position = vec2(float((gl_VertexIndex << 1) & 2), float(gl_VertexIndex & 2));
+    uv = position;
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+@end
+
+/* downsample one pyramid level, the first level also applies the bloom threshold */
+@fs post_fs_downsample
+in vec2 uv;
+out vec4 frag_color;
+
+uniform post_downsample_params {
+    vec2 texel_size;
+    float threshold;
+    float knee;
+};
+
+uniform layout(binding = 0) texture2D _post_source;
+uniform layout(binding = 0) sampler post_smp;
+#define post_source sampler2D(_post_source, post_smp)
+
+void main() {
+    // four bilinear taps average a 4x4 texel footprint of the source level
+    vec3 c = texture(post_source, uv + vec2(-texel_size.x, -texel_size.y)).rgb;
+    c += texture(post_source, uv + vec2( texel_size.x, -texel_size.y)).rgb;
+    c += texture(post_source, uv + vec2(-texel_size.x,  texel_size.y)).rgb;
+    c += texture(post_source, uv + vec2( texel_size.x,  texel_size.y)).rgb;
+    c *= 0.25;
+
+    // soft knee threshold, a zero knee means this level is not the first one
+    if (knee > 0.0) {
+        float brightness = max(c.r, max(c.g, c.b));
+        float soft = clamp(brightness - threshold + knee, 0.0, 2.0 * knee);
+        soft = soft * soft / (4.0 * knee + 0.00001);
+        c *= max(soft, brightness - threshold) / max(brightness, 0.00001);
+    }
+
+    frag_color = vec4(c, 1.0);
+}
+@end
+
+/* upsample a pyramid level with a 3x3 tent filter, blended additively into the level above */
+@fs post_fs_upsample
+in vec2 uv;
+out vec4 frag_color;
+
+uniform post_upsample_params {
+    vec2 texel_size;
+    float radius;
+    float intensity;
+};
+
+uniform layout(binding = 0) texture2D _post_source;
+uniform layout(binding = 0) sampler post_smp;
+#define post_source sampler2D(_post_source, post_smp)
+
+void main() {
+    vec2 o = texel_size * radius;
+    vec3 c = texture(post_source, uv).rgb * 4.0;
+    c += texture(post_source, uv + vec2(-o.x, 0.0)).rgb * 2.0;
+    c += texture(post_source, uv + vec2( o.x, 0.0)).rgb * 2.0;
+    c += texture(post_source, uv + vec2(0.0, -o.y)).rgb * 2.0;
+    c += texture(post_source, uv + vec2(0.0,  o.y)).rgb * 2.0;
+    c += texture(post_source, uv + vec2(-o.x, -o.y)).rgb;
+    c += texture(post_source, uv + vec2( o.x, -o.y)).rgb;
+    c += texture(post_source, uv + vec2(-o.x,  o.y)).rgb;
+    c += texture(post_source, uv + vec2( o.x,  o.y)).rgb;
+
+    frag_color = vec4(c * (intensity / 16.0), 1.0);
+}
+@end
+
+/* combine the scene with the bloom and apply the CRT look */
+@fs post_fs_composite
+in vec2 uv;
+out vec4 frag_color;
+
+uniform post_composite_params {
+    vec2 resolution;
+    float bloom_intensity;
+    float crt_enabled;
+    float scanline_strength;
+    float vignette_strength;
+    float curvature;
+    float _unused;
+};
+
+uniform layout(binding = 0) texture2D _post_scene;
+uniform layout(binding = 1) texture2D _post_bloom;
+uniform layout(binding = 0) sampler post_smp;
+#define post_scene sampler2D(_post_scene, post_smp)
+#define post_bloom sampler2D(_post_bloom, post_smp)
+
+void main() {
+    vec2 screen_uv = uv;
+    if (crt_enabled > 0.5) {
+        // barrel distortion, anything pushed outside the tube is black
+        vec2 centered = uv * 2.0 - 1.0;
+        centered *= 1.0 + curvature * dot(centered.yx, centered.yx);
+        screen_uv = centered * 0.5 + 0.5;
+        if (screen_uv.x < 0.0 || screen_uv.x > 1.0 || screen_uv.y < 0.0 || screen_uv.y > 1.0) {
+            frag_color = vec4(0.0, 0.0, 0.0, 1.0);
+            return;
+        }
+    }
+
+    vec3 c = texture(post_scene, screen_uv).rgb;
+    c += texture(post_bloom, screen_uv).rgb * bloom_intensity;
+
+    if (crt_enabled > 0.5) {
+        float scanline = 0.5 + 0.5 * sin(screen_uv.y * resolution.y * 3.14159265);
+        c *= 1.0 - scanline_strength * scanline;
+
+        vec2 edge = screen_uv * (1.0 - screen_uv);
+        c *= mix(1.0, pow(edge.x * edge.y * 16.0, 0.25), vignette_strength);
+    }
+
+    frag_color = vec4(c, 1.0);
+}
+@end
+
+@program post_downsample post_vs post_fs_downsample
+@program post_upsample post_vs post_fs_upsample
+@program post_composite post_vs post_fs_composite
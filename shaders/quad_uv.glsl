@@ -1,5 +1,13 @@
 /* quad vertex shader */
 @vs vs
+// Per frame transform palette, every transform is the first two rows of a 2D affine
+// matrix in .xyz with the depth scale and offset packed into the .w components,
+// followed by the clip space rect of its viewport as min x, min y, max x, max y.
+// Keep the size in sync with MaxTransforms in render_context.hpp
+layout(binding = 0) uniform vs_params {
+    vec4 transforms[192];
+};
+
 in vec4 position;
 in vec4 color0;
 in vec4 bytes0;
@@ -8,9 +16,18 @@ in vec2 texcoord0;
 out vec4 color;
 out vec2 uv;
 out vec4 bytes;
+out vec4 clip_distances;
 
 void main() {
-    gl_Position = position;
+    // bytes0.y holds the palette index of the transform this vertex is drawn with
+    int index = int(bytes0.y * 255.0 + 0.5) * 3;
+    vec4 row0 = transforms[index];
+    vec4 row1 = transforms[index + 1];
+    vec4 clip = transforms[index + 2];
+    vec3 local = vec3(position.xy, 1.0);
+    gl_Position = vec4(dot(row0.xyz, local), dot(row1.xyz, local), position.z * row0.w + row1.w, 1.0);
+    // Distances to the viewport edges, negative outside. w is 1 so they interpolate linearly
+    clip_distances = vec4(gl_Position.xy - clip.xy, clip.zw - gl_Position.xy);
     color = color0;
     uv = texcoord0;
     bytes = bytes0;
@@ -22,6 +39,7 @@ void main() {
 in vec4 color;
 in vec2 uv;
 in vec4 bytes;
+in vec4 clip_distances;
 out vec4 frag_color;
 
 uniform layout(binding = 0) texture2D _texture0;
@@ -29,13 +47,25 @@ uniform layout(binding = 1) sampler texture0_smp;
 #define texture0 sampler2D(_texture0, texture0_smp)
 
 void main() {
-    int texture_index = int(bytes.x * 255.0);
+    // Viewports share the window, whatever spills out of one mustn't draw over its neighbour
+    if (any(lessThan(clip_distances, vec4(0.0)))) {
+        discard;
+    }
+
+    // Interpolated, round like the vertex shader does so 1 never comes out as 0.999 and truncates to 0
+    int texture_index = int(bytes.x * 255.0 + 0.5);
 
     vec4 texture_color = vec4(1.0);
     if (texture_index == 0){
         // this is text, it's only got the single .r channel so we stuff it into the alpha
         texture_color.a = texture(texture0, uv).r;
     }
+    else if (texture_index == 1){
+        // distance field text, the outline sits at 0.5 and fwidth keeps the edge about a pixel wide at any scale
+        float distance = texture(texture0, uv).r;
+        float edge_width = fwidth(distance);
+        texture_color.a = smoothstep(0.5 - edge_width, 0.5 + edge_width, distance);
+    }
 
     frag_color = texture_color * color;
 }
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef BAKED_FONT_HPP
+#define BAKED_FONT_HPP
+
+#include <cstdint>
+
+// Shared between the runtime glyph cache and tools/font_baker.cpp, which has to rasterize
+// glyphs exactly the way GlyphCache would
+
+enum class FontMode : uint8_t{
+    // Antialiased coverage rasterized per pixel height
+    Coverage,
+    // Signed distance field rasterized once at SdfPixelHeight and scaled to any size by the shader
+    DistanceField,
+};
+
+// Distance field glyphs are stored at this height, with the field fading out over SdfPadding pixels
+constexpr int SdfPixelHeight = 32;
+constexpr int SdfPadding = 4;
+// Atlas value of the glyph outline, the shader's 0.5 threshold
+constexpr int SdfOnEdge = 128;
+
+// Baked font file, little endian:
+//   BakedFontHeader
+//   BakedGlyph[glyphCount]
+//   width * height R8 atlas pixels, row major from the top
+// The pixels are copied to the top left of the glyph atlas as is, so width is the atlas width
+// and height is a whole number of atlas pages.
+constexpr uint32_t BakedFontMagic = 0x42465053; // "SPFB"
+constexpr uint32_t BakedFontVersion = 1;
+
+#pragma pack(push, 1)
+struct BakedFontHeader{
+    uint32_t magic;
+    uint32_t version;
+    uint16_t width;
+    uint16_t height;
+    uint16_t pixelHeight;
+    FontMode mode;
+    uint8_t sdfPadding;
+    uint8_t sdfOnEdge;
+    uint8_t _padding[3];
+    uint32_t glyphCount;
+    // Size of the ttf the bake came from, a cheap check against stale bakes
+    uint32_t sourceSize;
+};
+
+struct BakedGlyph{
+    uint32_t codepoint;
+    uint16_t x0, y0, x1, y1;
+    float xoff, yoff, xadvance;
+};
+#pragma pack(pop)
+
+#endif // BAKED_FONT_HPP
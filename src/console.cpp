@@ -0,0 +1,336 @@
+#include "console.hpp"
+#include "SDL_stdinc.h"
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#include "logging.h"
+
+static Color LevelColor(uint32_t logLevel)
+{
+    switch (logLevel)
+    {
+        case LOG_FATAL:
+        case LOG_ERROR:   return ColorFromHex(0xFF6A6AFF);
+        case LOG_WARNING: return ColorFromHex(0xFFD46AFF);
+        case LOG_DEBUG:   return ColorFromHex(0x8A8A8AFF);
+        default:          return ColorFromHex(0xD8D8D8FF);
+    }
+}
+
+void Console::Initialize()
+{
+    lines.resize(MaxLines);
+    visibleLines.reserve(64);
+
+    RegisterCommand("help", HelpCommand, this, "Lists all commands");
+    RegisterCommand("clear", ClearCommand, this, "Clears the history");
+
+    SetLogSink(LogSinkCallback, this);
+}
+
+void Console::Shutdown()
+{
+    SetLogSink(nullptr, nullptr);
+    SetOpen(false);
+}
+
+void Console::LogSinkCallback(uint32_t logLevel, const char* message, void* userData)
+{
+    static_cast<Console*>(userData)->Print(logLevel, message);
+}
+
+void Console::AddLine(const char* text, int length, uint8_t level)
+{
+    Line& line = lines[lineCount % MaxLines];
+    memcpy(line.text, text, length);
+    line.text[length] = '\0';
+    line.level = level;
+    lineCount++;
+
+    // Keep the window on the same lines while scrolled back
+    if (scrollOffset > 0 && scrollOffset < MaxLines)
+    {
+        scrollOffset++;
+    }
+}
+
+void Console::Print(uint32_t logLevel, const char* message)
+{
+    assert(message != nullptr);
+
+    SDL_AtomicLock(&lock);
+    // Split on newlines and wrap long lines here, once, so drawing only ever copies whole lines
+    const char* start = message;
+    while (true)
+    {
+        const char* end = start;
+        while (*end != '\0' && *end != '\n' && end - start < LineLength - 1)
+        {
+            end++;
+        }
+        // Don't cut a UTF-8 sequence in half when wrapping
+        if (*end != '\0' && *end != '\n')
+        {
+            const char* boundary = end;
+            while (boundary > start && (static_cast<unsigned char>(*boundary) & 0xC0) == 0x80)
+            {
+                boundary--;
+            }
+            if (boundary > start)
+            {
+                end = boundary;
+            }
+        }
+
+        AddLine(start, static_cast<int>(end - start), static_cast<uint8_t>(logLevel));
+
+        if (*end == '\0')
+        {
+            break;
+        }
+        start = *end == '\n' ? end + 1 : end;
+        if (*start == '\0')
+        {
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&lock);
+}
+
+void Console::RegisterCommand(const char* name, ConsoleCommand func, void* userData, const char* help /* = "" */)
+{
+    assert(name != nullptr && func != nullptr);
+    commands.push_back({name, help, func, userData});
+}
+
+void Console::Clear()
+{
+    SDL_AtomicLock(&lock);
+    lineCount = 0;
+    scrollOffset = 0;
+    SDL_AtomicUnlock(&lock);
+}
+
+void Console::SetOpen(bool open)
+{
+    if (this->open == open)
+    {
+        return;
+    }
+
+    this->open = open;
+    if (open)
+    {
+        SDL_StartTextInput();
+    }
+    else
+    {
+        SDL_StopTextInput();
+    }
+}
+
+void Console::HelpCommand(const char* args, void* userData)
+{
+    Console* console = static_cast<Console*>(userData);
+    for (const Command& command : console->commands)
+    {
+        char message[LineLength * 2];
+        SDL_snprintf(message, sizeof(message), "%s - %s", command.name.c_str(), command.help.c_str());
+        console->Print(LOG_INFO, message);
+    }
+}
+
+void Console::ClearCommand(const char* args, void* userData)
+{
+    static_cast<Console*>(userData)->Clear();
+}
+
+void Console::Execute()
+{
+    char echo[MaxInputLength + 2];
+    SDL_snprintf(echo, sizeof(echo), "> %s", input);
+    Print(LOG_INFO, echo);
+
+    const char* name = input;
+    while (*name == ' ')
+    {
+        name++;
+    }
+    size_t nameLength = strcspn(name, " ");
+    const char* args = name + nameLength;
+    while (*args == ' ')
+    {
+        args++;
+    }
+
+    if (nameLength > 0)
+    {
+        bool found = false;
+        for (const Command& command : commands)
+        {
+            if (command.name.size() == nameLength && memcmp(command.name.c_str(), name, nameLength) == 0)
+            {
+                command.func(args, command.userData);
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+        {
+            Print(LOG_WARNING, "Unknown command, try help");
+        }
+    }
+
+    inputLength = 0;
+    input[0] = '\0';
+    SDL_AtomicLock(&lock);
+    scrollOffset = 0;
+    SDL_AtomicUnlock(&lock);
+}
+
+void Console::Scroll(int lineDelta)
+{
+    SDL_AtomicLock(&lock);
+    uint64_t stored = lineCount < MaxLines ? lineCount : MaxLines;
+    int64_t maxOffset = stored > pageLines ? static_cast<int64_t>(stored - pageLines) : 0;
+    int64_t offset = static_cast<int64_t>(scrollOffset) + lineDelta;
+    scrollOffset = static_cast<uint32_t>(offset < 0 ? 0 : (offset > maxOffset ? maxOffset : offset));
+    SDL_AtomicUnlock(&lock);
+}
+
+bool Console::HandleEvent(const SDL_Event& event)
+{
+    if (event.type == SDL_KEYDOWN && event.key.keysym.scancode == SDL_SCANCODE_GRAVE)
+    {
+        if (!event.key.repeat)
+        {
+            SetOpen(!open);
+        }
+        return true;
+    }
+
+    // Key releases always reach the game so nothing stays held while the console is open
+    if (!open)
+    {
+        return false;
+    }
+
+    if (event.type == SDL_TEXTINPUT)
+    {
+        // Whole events or nothing, so a full line never ends in half a UTF-8 sequence
+        if (inputLength + static_cast<int>(strlen(event.text.text)) >= MaxInputLength)
+        {
+            return true;
+        }
+        for (const char* c = event.text.text; *c != '\0'; c++)
+        {
+            // The toggle key itself still comes through as text on some platforms
+            if (*c != '`')
+            {
+                input[inputLength++] = *c;
+            }
+        }
+        input[inputLength] = '\0';
+        return true;
+    }
+    else if (event.type == SDL_KEYDOWN)
+    {
+        switch (event.key.keysym.scancode)
+        {
+            case SDL_SCANCODE_RETURN:
+            case SDL_SCANCODE_KP_ENTER:
+                Execute();
+                break;
+            case SDL_SCANCODE_BACKSPACE:
+                // Drop a whole UTF-8 sequence
+                while (inputLength > 0 && (static_cast<unsigned char>(input[--inputLength]) & 0xC0) == 0x80)
+                {
+                }
+                input[inputLength] = '\0';
+                break;
+            case SDL_SCANCODE_ESCAPE:
+                SetOpen(false);
+                break;
+            case SDL_SCANCODE_PAGEUP:
+                Scroll(static_cast<int>(pageLines));
+                break;
+            case SDL_SCANCODE_PAGEDOWN:
+                Scroll(-static_cast<int>(pageLines));
+                break;
+            case SDL_SCANCODE_HOME:
+                Scroll(static_cast<int>(MaxLines));
+                break;
+            case SDL_SCANCODE_END:
+                Scroll(-static_cast<int>(MaxLines));
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+    else if (event.type == SDL_MOUSEWHEEL)
+    {
+        Scroll(event.wheel.y * 3);
+        return true;
+    }
+    return false;
+}
+
+void Console::Draw(Renderer& renderer)
+{
+    if (!open)
+    {
+        return;
+    }
+
+    Vector2 uiSize = renderer.GetViewportSize();
+    float lineHeight = font.id != InvalidFont ? static_cast<float>(font.pixelHeight) : renderer.GetLineHeight();
+    float height = roundf(uiSize.Y * 0.5f);
+    renderer.DrawRectangle({0, 0}, {uiSize.X, height}, ColorFromHex(0x101010E0));
+
+    // The input line sits at the bottom of the panel
+    int windowLines = static_cast<int>((height - lineHeight) / lineHeight);
+    if (windowLines < 1)
+    {
+        windowLines = 1;
+    }
+
+    // Copy the window out so log messages raised while drawing can't deadlock on the lock
+    SDL_AtomicLock(&lock);
+    pageLines = static_cast<uint32_t>(windowLines);
+    uint64_t stored = lineCount < MaxLines ? lineCount : MaxLines;
+    uint64_t last = lineCount - (scrollOffset < stored ? scrollOffset : stored);
+    uint64_t first = last > static_cast<uint64_t>(windowLines) ? last - windowLines : 0;
+    if (first < lineCount - stored)
+    {
+        first = lineCount - stored;
+    }
+    visibleLines.clear();
+    for (uint64_t i = first; i < last; i++)
+    {
+        visibleLines.push_back(lines[i % MaxLines]);
+    }
+    SDL_AtomicUnlock(&lock);
+
+    // Text is placed on its baseline, leave the bottom fifth of each line for descenders
+    float baseline = roundf(lineHeight * 0.8f);
+
+    // Oldest at the top, newest right above the input line
+    textBatch.clear();
+    float y = height - lineHeight * (visibleLines.size() + 1);
+    for (const Line& line : visibleLines)
+    {
+        if (line.text[0] != '\0')
+        {
+            textBatch.push_back({{4.f, y + baseline}, line.text, LevelColor(line.level), FontAlignment::Left, font});
+        }
+        y += lineHeight;
+    }
+
+    char prompt[MaxInputLength + 3];
+    SDL_snprintf(prompt, sizeof(prompt), "> %s_", input);
+    textBatch.push_back({{4.f, height - lineHeight + baseline}, prompt, Colors::White, FontAlignment::Left, font});
+
+    renderer.DrawTextBatch(textBatch.data(), textBatch.size());
+}
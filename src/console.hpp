@@ -0,0 +1,89 @@
+#pragma once
+#ifndef CONSOLE_HPP
+#define CONSOLE_HPP
+
+#include <cstdint>
+#include "math_types.hpp"
+#include "renderer.hpp"
+#include "SDL_atomic.h"
+#include "SDL_events.h"
+#include <string>
+#include <vector>
+
+typedef void (*ConsoleCommand)(const char* args, void* userData);
+
+// In-game console showing the LOG output and running registered commands, toggled with the backquote key.
+// History lives in a ring of fixed size display lines, messages are split into lines once when they
+// arrive so drawing never re-wraps anything. Only the lines inside the visible window are drawn,
+// their layouts stay in the text layout cache while scrolling since the line text doesn't change.
+class Console
+{
+public:
+    static constexpr uint32_t MaxLines = 32768;
+    // Bytes per display line including the terminator, longer messages continue on the next line
+    static constexpr int LineLength = 96;
+    static constexpr int MaxInputLength = 128;
+
+private:
+    struct Line{
+        char text[LineLength];
+        uint8_t level;
+    };
+
+    std::vector<Line> lines;
+    // Total lines ever added, the newest line is at (lineCount - 1) % MaxLines
+    uint64_t lineCount = 0;
+    // Lines between the bottom of the window and the newest line
+    uint32_t scrollOffset = 0;
+    // Lines the window showed last frame, what page up and down scroll by
+    uint32_t pageLines = 1;
+    // Log messages may come from other threads
+    SDL_SpinLock lock = 0;
+    // Copy of the lines drawn this frame
+    std::vector<Line> visibleLines;
+    std::vector<TextBatchEntry> textBatch;
+
+    struct Command{
+        std::string name;
+        std::string help;
+        ConsoleCommand func;
+        void* userData;
+    };
+    std::vector<Command> commands;
+
+    // InvalidFont draws with the renderer's font
+    Font font = {.id = InvalidFont};
+
+    char input[MaxInputLength] = {};
+    int inputLength = 0;
+    bool open = false;
+
+    void AddLine(const char* text, int length, uint8_t level);
+    void Execute();
+    void Scroll(int lines);
+
+    static void LogSinkCallback(uint32_t logLevel, const char* message, void* userData);
+    static void HelpCommand(const char* args, void* userData);
+    static void ClearCommand(const char* args, void* userData);
+public:
+    // Hooks the console into log_func and registers the built in commands
+    void Initialize();
+    void Shutdown();
+
+    void Print(uint32_t logLevel, const char* message);
+    void RegisterCommand(const char* name, ConsoleCommand func, void* userData, const char* help = "");
+    void Clear();
+
+    void SetFont(Font font) { this->font = font; }
+
+    void SetOpen(bool open);
+    bool IsOpen() const { return open; }
+
+    // Returns true if the event was meant for the console and shouldn't reach the game
+    bool HandleEvent(const SDL_Event& event);
+
+    // Draws the top half of the screen, call between BeginUI and EndUI
+    void Draw(Renderer& renderer);
+};
+
+#endif // CONSOLE_HPP
@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef FIXED_POINT_HPP
+#define FIXED_POINT_HPP
+
+#include "math_types.hpp"
+#include <cstdint>
+
+// Q16.16 fixed point for the simulation. Integer math gives the same bits on every compiler,
+// optimization level and CPU, which float math doesn't guarantee
+typedef int32_t Fixed;
+
+constexpr int FixedFractionBits = 16;
+constexpr Fixed FixedOne = 1 << FixedFractionBits;
+
+// Rounds to the nearest representable value. Meant for constants and for inputs at the
+// boundary of the simulation, both give the same result everywhere
+constexpr Fixed FixedFromFloat(double value)
+{
+    return static_cast<Fixed>(value * FixedOne + (value >= 0.0 ? 0.5 : -0.5));
+}
+
+constexpr float FixedToFloat(Fixed value)
+{
+    return value * (1.f / FixedOne);
+}
+
+constexpr Fixed FixedMul(Fixed a, Fixed b)
+{
+    return static_cast<Fixed>((static_cast<int64_t>(a) * b) >> FixedFractionBits);
+}
+
+constexpr Fixed FixedDiv(Fixed a, Fixed b)
+{
+    return static_cast<Fixed>((static_cast<int64_t>(a) * FixedOne) / b);
+}
+
+constexpr Fixed FixedClamp(Fixed min, Fixed value, Fixed max)
+{
+    return value < min ? min : (value > max ? max : value);
+}
+
+struct FixedVector2{
+    Fixed X;
+    Fixed Y;
+};
+
+constexpr FixedVector2 operator+(FixedVector2 a, FixedVector2 b) { return {a.X + b.X, a.Y + b.Y}; }
+constexpr FixedVector2 operator-(FixedVector2 a, FixedVector2 b) { return {a.X - b.X, a.Y - b.Y}; }
+constexpr FixedVector2& operator+=(FixedVector2& a, FixedVector2 b) { a.X += b.X; a.Y += b.Y; return a; }
+
+constexpr FixedVector2 FixedVector2FromVector2(Vector2 value)
+{
+    return {FixedFromFloat(value.X), FixedFromFloat(value.Y)};
+}
+
+constexpr Vector2 FixedVector2ToVector2(FixedVector2 value)
+{
+    return {FixedToFloat(value.X), FixedToFloat(value.Y)};
+}
+
+#endif // FIXED_POINT_HPP
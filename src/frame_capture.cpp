@@ -0,0 +1,508 @@
+#include "frame_capture.hpp"
+#include "SDL_video.h"
+#include "SDL_opengl.h"
+#include "SDL_rwops.h"
+#include "SDL_stdinc.h"
+#include <cassert>
+#include <cstring>
+
+#include "logging.h"
+#include "stb_image_write.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CAPTURE_SSE2
+    #include <emmintrin.h>
+#endif
+
+// sokol loads GL privately, capture only needs a handful of entry points so it loads its own
+typedef void (APIENTRYP PFNGLREADPIXELSPROC_CAPTURE) (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+static struct {
+    PFNGLGENBUFFERSPROC GenBuffers;
+    PFNGLDELETEBUFFERSPROC DeleteBuffers;
+    PFNGLBINDBUFFERPROC BindBuffer;
+    PFNGLBUFFERDATAPROC BufferData;
+    PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+    PFNGLUNMAPBUFFERPROC UnmapBuffer;
+    PFNGLFENCESYNCPROC FenceSync;
+    PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+    PFNGLDELETESYNCPROC DeleteSync;
+    PFNGLREADPIXELSPROC_CAPTURE ReadPixels;
+} gl;
+
+bool FrameCapture::LoadGL()
+{
+    if (glLoaded)
+    {
+        return true;
+    }
+
+    gl.GenBuffers = (PFNGLGENBUFFERSPROC)SDL_GL_GetProcAddress("glGenBuffers");
+    gl.DeleteBuffers = (PFNGLDELETEBUFFERSPROC)SDL_GL_GetProcAddress("glDeleteBuffers");
+    gl.BindBuffer = (PFNGLBINDBUFFERPROC)SDL_GL_GetProcAddress("glBindBuffer");
+    gl.BufferData = (PFNGLBUFFERDATAPROC)SDL_GL_GetProcAddress("glBufferData");
+    gl.MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)SDL_GL_GetProcAddress("glMapBufferRange");
+    gl.UnmapBuffer = (PFNGLUNMAPBUFFERPROC)SDL_GL_GetProcAddress("glUnmapBuffer");
+    gl.FenceSync = (PFNGLFENCESYNCPROC)SDL_GL_GetProcAddress("glFenceSync");
+    gl.ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)SDL_GL_GetProcAddress("glClientWaitSync");
+    gl.DeleteSync = (PFNGLDELETESYNCPROC)SDL_GL_GetProcAddress("glDeleteSync");
+    gl.ReadPixels = (PFNGLREADPIXELSPROC_CAPTURE)SDL_GL_GetProcAddress("glReadPixels");
+
+    glLoaded = gl.GenBuffers && gl.DeleteBuffers && gl.BindBuffer && gl.BufferData && gl.MapBufferRange &&
+        gl.UnmapBuffer && gl.FenceSync && gl.ClientWaitSync && gl.DeleteSync && gl.ReadPixels;
+    if (!glLoaded)
+    {
+        LOG(LOG_ERROR, "Frame capture could not load the GL functions it needs");
+    }
+    return glLoaded;
+}
+
+#ifdef CAPTURE_SSE2
+// Dot product of 4 RGBA pixels with (r, g, b, a) weights, one int32 per pixel
+static inline __m128i Dot4(__m128i pixels, __m128i weights)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(pixels, zero), weights);
+    __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(pixels, zero), weights);
+    lo = _mm_add_epi32(lo, _mm_srli_epi64(lo, 32));
+    hi = _mm_add_epi32(hi, _mm_srli_epi64(hi, 32));
+    lo = _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+    hi = _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_unpacklo_epi64(lo, hi);
+}
+
+// (sum + 128) >> 8 + bias, saturated to bytes, 4 results in the low 32 bits
+static inline int PackBytes4(__m128i sums, int bias)
+{
+    __m128i v = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(sums, _mm_set1_epi32(128)), 8), _mm_set1_epi32(bias));
+    v = _mm_packs_epi32(v, v);
+    v = _mm_packus_epi16(v, v);
+    return _mm_cvtsi128_si32(v);
+}
+#endif
+
+// BT.601 limited range, the rows of the source are bottom up like glReadPixels returns them
+static inline uint8_t LumaOf(const uint8_t* p)
+{
+    return static_cast<uint8_t>(((66 * p[0] + 129 * p[1] + 25 * p[2] + 128) >> 8) + 16);
+}
+
+static inline void ChromaOf(const uint8_t* p0, const uint8_t* p1, const uint8_t* p2, const uint8_t* p3, uint8_t* u, uint8_t* v)
+{
+    int r = (p0[0] + p1[0] + p2[0] + p3[0] + 2) >> 2;
+    int g = (p0[1] + p1[1] + p2[1] + p3[1] + 2) >> 2;
+    int b = (p0[2] + p1[2] + p2[2] + p3[2] + 2) >> 2;
+    *u = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+    *v = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+static void ConvertRGBAToYUV420(const uint8_t* rgba, int width, int height, uint8_t* yPlane, uint8_t* uPlane, uint8_t* vPlane)
+{
+    const int stride = width * 4;
+    const int chromaWidth = (width + 1) / 2;
+
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t* src = rgba + (height - 1 - y) * stride;
+        uint8_t* dst = yPlane + y * width;
+        int x = 0;
+#ifdef CAPTURE_SSE2
+        const __m128i lumaWeights = _mm_setr_epi16(66, 129, 25, 0, 66, 129, 25, 0);
+        for (; x + 4 <= width; x += 4)
+        {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+            int packed = PackBytes4(Dot4(pixels, lumaWeights), 16);
+            memcpy(dst + x, &packed, 4);
+        }
+#endif
+        for (; x < width; x++)
+        {
+            dst[x] = LumaOf(src + x * 4);
+        }
+    }
+
+    for (int cy = 0; cy < (height + 1) / 2; cy++)
+    {
+        // Odd heights reuse the last row for the final chroma line
+        int row0 = cy * 2;
+        int row1 = SDL_min(row0 + 1, height - 1);
+        const uint8_t* src0 = rgba + (height - 1 - row0) * stride;
+        const uint8_t* src1 = rgba + (height - 1 - row1) * stride;
+        uint8_t* u = uPlane + cy * chromaWidth;
+        uint8_t* v = vPlane + cy * chromaWidth;
+        int cx = 0;
+#ifdef CAPTURE_SSE2
+        const __m128i uWeights = _mm_setr_epi16(-38, -74, 112, 0, -38, -74, 112, 0);
+        const __m128i vWeights = _mm_setr_epi16(112, -94, -18, 0, 112, -94, -18, 0);
+        for (; cx * 2 + 8 <= width; cx += 4)
+        {
+            // Average 2x2 blocks: vertically with avg_epu8, then neighbouring pixels in each row
+            __m128i a = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + cx * 8)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + cx * 8)));
+            __m128i b = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src0 + cx * 8 + 16)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(src1 + cx * 8 + 16)));
+            a = _mm_avg_epu8(a, _mm_srli_si128(a, 4));
+            b = _mm_avg_epu8(b, _mm_srli_si128(b, 4));
+            a = _mm_shuffle_epi32(a, _MM_SHUFFLE(3, 1, 2, 0));
+            b = _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 0));
+            __m128i blocks = _mm_unpacklo_epi64(a, b);
+
+            int packedU = PackBytes4(Dot4(blocks, uWeights), 128);
+            int packedV = PackBytes4(Dot4(blocks, vWeights), 128);
+            memcpy(u + cx, &packedU, 4);
+            memcpy(v + cx, &packedV, 4);
+        }
+#endif
+        for (; cx < chromaWidth; cx++)
+        {
+            int x0 = cx * 2;
+            int x1 = SDL_min(x0 + 1, width - 1);
+            ChromaOf(src0 + x0 * 4, src0 + x1 * 4, src1 + x0 * 4, src1 + x1 * 4, u + cx, v + cx);
+        }
+    }
+}
+
+void FrameCapture::Shutdown()
+{
+    if (active)
+    {
+        Stop();
+    }
+    JoinWorker();
+
+    if (glLoaded)
+    {
+        ReleaseReadbacks();
+        for (Readback& readback : readbacks)
+        {
+            if (readback.buffer != 0)
+            {
+                gl.DeleteBuffers(1, &readback.buffer);
+                readback.buffer = 0;
+            }
+        }
+    }
+
+    if (cond != nullptr)
+    {
+        SDL_DestroyCond(cond);
+        cond = nullptr;
+    }
+    if (mutex != nullptr)
+    {
+        SDL_DestroyMutex(mutex);
+        mutex = nullptr;
+    }
+}
+
+bool FrameCapture::Start(const char* path, CaptureFormat format, int width, int height, int fps)
+{
+    assert(!active && "Capture already running");
+
+    if (worker != nullptr)
+    {
+        if (SDL_AtomicGet(&workerDone) == 0)
+        {
+            LOG(LOG_WARNING, "Previous capture is still being written, try again later");
+            return false;
+        }
+        JoinWorker();
+    }
+
+    if (!LoadGL())
+    {
+        return false;
+    }
+
+    if (mutex == nullptr)
+    {
+        mutex = SDL_CreateMutex();
+        cond = SDL_CreateCond();
+    }
+
+    SDL_strlcpy(this->path, path, sizeof(this->path));
+    this->format = format;
+    this->width = width;
+    this->height = height;
+    this->fps = fps;
+
+    size_t frameSize = static_cast<size_t>(width) * height * 4;
+    for (int i = 0; i < QueueCapacity; i++)
+    {
+        slotPixels[i] = static_cast<uint8_t*>(SDL_malloc(frameSize));
+        freeSlots[i] = i;
+    }
+    freeCount = QueueCapacity;
+    readyHead = 0;
+    readyCount = 0;
+    stopRequested = false;
+
+    stats = {};
+    SDL_AtomicSet(&written, 0);
+    SDL_AtomicSet(&workerDone, 0);
+
+    worker = SDL_CreateThread(WorkerMain, "FrameCapture", this);
+    if (worker == nullptr)
+    {
+        LOG(LOG_ERROR, "Could not start the frame capture thread");
+        SDL_ClearError();
+        for (int i = 0; i < QueueCapacity; i++)
+        {
+            SDL_free(slotPixels[i]);
+            slotPixels[i] = nullptr;
+        }
+        return false;
+    }
+
+    active = true;
+    return true;
+}
+
+void FrameCapture::Stop()
+{
+    if (!active)
+    {
+        return;
+    }
+    active = false;
+
+    // Whatever is still in flight on the GPU is not worth waiting for
+    for (const Readback& readback : readbacks)
+    {
+        stats.dropped += readback.pending ? 1 : 0;
+    }
+    ReleaseReadbacks();
+
+    SDL_LockMutex(mutex);
+    stopRequested = true;
+    SDL_CondSignal(cond);
+    SDL_UnlockMutex(mutex);
+}
+
+void FrameCapture::ReleaseReadbacks()
+{
+    for (Readback& readback : readbacks)
+    {
+        if (readback.pending)
+        {
+            gl.DeleteSync(static_cast<GLsync>(readback.fence));
+            readback.fence = nullptr;
+            readback.pending = false;
+        }
+    }
+}
+
+void FrameCapture::JoinWorker()
+{
+    if (worker == nullptr)
+    {
+        return;
+    }
+
+    SDL_WaitThread(worker, nullptr);
+    worker = nullptr;
+
+    for (int i = 0; i < QueueCapacity; i++)
+    {
+        SDL_free(slotPixels[i]);
+        slotPixels[i] = nullptr;
+    }
+}
+
+void FrameCapture::Harvest()
+{
+    // Readbacks complete in issue order, the oldest one sits right after the last issued
+    for (int i = 0; i < ReadbackCount; i++)
+    {
+        Readback& readback = readbacks[(nextReadback + i) % ReadbackCount];
+        if (!readback.pending)
+        {
+            continue;
+        }
+
+        GLenum status = gl.ClientWaitSync(static_cast<GLsync>(readback.fence), 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        {
+            break;
+        }
+        gl.DeleteSync(static_cast<GLsync>(readback.fence));
+        readback.fence = nullptr;
+        readback.pending = false;
+
+        SDL_LockMutex(mutex);
+        int slot = freeCount > 0 ? freeSlots[--freeCount] : -1;
+        SDL_UnlockMutex(mutex);
+
+        if (slot < 0)
+        {
+            // The encoder fell behind, never wait for it
+            stats.dropped++;
+            continue;
+        }
+
+        size_t frameSize = static_cast<size_t>(readback.width) * readback.height * 4;
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        void* mapped = gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frameSize, GL_MAP_READ_BIT);
+        if (mapped != nullptr)
+        {
+            memcpy(slotPixels[slot], mapped, frameSize);
+            gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        SDL_LockMutex(mutex);
+        if (mapped != nullptr)
+        {
+            readySlots[(readyHead + readyCount) % QueueCapacity] = slot;
+            readyCount++;
+            SDL_CondSignal(cond);
+        }
+        else
+        {
+            freeSlots[freeCount++] = slot;
+        }
+        SDL_UnlockMutex(mutex);
+
+        if (mapped != nullptr)
+        {
+            stats.captured++;
+        }
+        else
+        {
+            stats.dropped++;
+        }
+    }
+}
+
+void FrameCapture::CaptureFrame(int width, int height)
+{
+    if (!active)
+    {
+        // Clean up after a stopped capture once its worker has drained the queue
+        if (worker != nullptr && SDL_AtomicGet(&workerDone) != 0)
+        {
+            JoinWorker();
+        }
+        return;
+    }
+
+    Harvest();
+
+    Readback& readback = readbacks[nextReadback];
+    if (width != this->width || height != this->height || readback.pending)
+    {
+        stats.dropped++;
+        return;
+    }
+
+    gl.BindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    if (readback.buffer == 0 || readback.width != width || readback.height != height)
+    {
+        if (readback.buffer == 0)
+        {
+            gl.GenBuffers(1, &readback.buffer);
+            gl.BindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        }
+        gl.BufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(width) * height * 4, nullptr, GL_STREAM_READ);
+        readback.width = width;
+        readback.height = height;
+    }
+
+    // With a pack buffer bound this only queues the copy, the data is picked up a few frames later
+    gl.ReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback.fence = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    readback.pending = true;
+    nextReadback = (nextReadback + 1) % ReadbackCount;
+}
+
+CaptureStats FrameCapture::GetStats() const
+{
+    CaptureStats result = stats;
+    result.written = static_cast<uint64_t>(SDL_AtomicGet(const_cast<SDL_atomic_t*>(&written)));
+    return result;
+}
+
+int FrameCapture::WorkerMain(void* data)
+{
+    static_cast<FrameCapture*>(data)->WorkerLoop();
+    return 0;
+}
+
+void FrameCapture::WorkerLoop()
+{
+    SDL_RWops* file = nullptr;
+    uint8_t* yuv = nullptr;
+    size_t lumaSize = static_cast<size_t>(width) * height;
+    size_t chromaSize = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+
+    if (format == CaptureFormat::Y4M)
+    {
+        file = SDL_RWFromFile(path, "wb");
+        if (file == nullptr)
+        {
+            LOG(LOG_ERROR, "Could not open the capture file");
+            SDL_ClearError();
+        }
+        else
+        {
+            char header[128];
+            int length = SDL_snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, fps);
+            SDL_RWwrite(file, header, 1, length);
+        }
+        yuv = static_cast<uint8_t*>(SDL_malloc(lumaSize + chromaSize * 2));
+    }
+    else
+    {
+        stbi_flip_vertically_on_write(1);
+    }
+
+    uint64_t frameIndex = 0;
+    for (;;)
+    {
+        SDL_LockMutex(mutex);
+        while (readyCount == 0 && !stopRequested)
+        {
+            SDL_CondWait(cond, mutex);
+        }
+        if (readyCount == 0)
+        {
+            SDL_UnlockMutex(mutex);
+            break;
+        }
+        int slot = readySlots[readyHead];
+        readyHead = (readyHead + 1) % QueueCapacity;
+        readyCount--;
+        SDL_UnlockMutex(mutex);
+
+        const uint8_t* pixels = slotPixels[slot];
+        if (format == CaptureFormat::Y4M)
+        {
+            if (file != nullptr)
+            {
+                ConvertRGBAToYUV420(pixels, width, height, yuv, yuv + lumaSize, yuv + lumaSize + chromaSize);
+                SDL_RWwrite(file, "FRAME\n", 1, 6);
+                SDL_RWwrite(file, yuv, 1, lumaSize + chromaSize * 2);
+            }
+        }
+        else
+        {
+            char framePath[600];
+            SDL_snprintf(framePath, sizeof(framePath), "%s_%06llu.png", path, static_cast<unsigned long long>(frameIndex));
+            stbi_write_png(framePath, width, height, 4, pixels, width * 4);
+        }
+        frameIndex++;
+
+        SDL_LockMutex(mutex);
+        freeSlots[freeCount++] = slot;
+        SDL_UnlockMutex(mutex);
+        SDL_AtomicAdd(&written, 1);
+    }
+
+    if (file != nullptr)
+    {
+        SDL_RWclose(file);
+    }
+    SDL_free(yuv);
+    SDL_AtomicSet(&workerDone, 1);
+}
@@ -0,0 +1,85 @@
+#pragma once
+#ifndef FRAME_CAPTURE_HPP
+#define FRAME_CAPTURE_HPP
+
+#include "SDL_thread.h"
+#include "SDL_mutex.h"
+#include "SDL_atomic.h"
+#include <cstdint>
+
+enum class CaptureFormat{
+    Y4M,
+    PngSequence,
+};
+
+struct CaptureStats{
+    uint64_t captured;
+    uint64_t written;
+    // Frames lost because the readback ring or the encode queue was full, or the window size changed
+    uint64_t dropped;
+};
+
+// Records every rendered frame without stalling the main loop. The swapchain is read back
+// asynchronously into a ring of pixel buffer objects, finished readbacks are copied into a
+// bounded queue and a worker thread converts and writes them to disk.
+class FrameCapture
+{
+private:
+    static constexpr int ReadbackCount = 3;
+    static constexpr int QueueCapacity = 8;
+
+    struct Readback{
+        unsigned int buffer;
+        void* fence;
+        int width, height;
+        bool pending;
+    };
+
+    Readback readbacks[ReadbackCount] = {};
+    int nextReadback = 0;
+    bool glLoaded = false;
+
+    // Encode queue, slots move free -> ready (main thread) -> free (worker thread)
+    uint8_t* slotPixels[QueueCapacity] = {};
+    int freeSlots[QueueCapacity];
+    int freeCount = 0;
+    int readySlots[QueueCapacity];
+    int readyHead = 0;
+    int readyCount = 0;
+    SDL_mutex* mutex = nullptr;
+    SDL_cond* cond = nullptr;
+    bool stopRequested = false;
+
+    SDL_Thread* worker = nullptr;
+    SDL_atomic_t workerDone;
+
+    char path[512];
+    CaptureFormat format;
+    int width = 0, height = 0;
+    int fps = 60;
+    bool active = false;
+
+    CaptureStats stats;
+    SDL_atomic_t written;
+
+    bool LoadGL();
+    void Harvest();
+    void ReleaseReadbacks();
+    void JoinWorker();
+    static int WorkerMain(void* data);
+    void WorkerLoop();
+public:
+    void Shutdown();
+
+    bool Start(const char* path, CaptureFormat format, int width, int height, int fps = 60);
+    // Stops queueing new frames, the worker finishes writing the backlog on its own
+    void Stop();
+    bool IsActive() const { return active; }
+
+    // Call after sg_commit and before the swap, with the swapchain bound for reading
+    void CaptureFrame(int width, int height);
+
+    CaptureStats GetStats() const;
+};
+
+#endif // FRAME_CAPTURE_HPP
@@ -4,6 +4,9 @@
 #define GAME_STATE_HPP
 
 #include "math_types.hpp"
+#include "fixed_point.hpp"
+#include <cstdint>
+#include <type_traits>
 
 enum PongState{
     PONG_WAITING,
@@ -14,16 +17,39 @@ enum PongState{
 struct GameState{
     PongState state;
 
-    Vector2 paddlePositionLeft;
-    Vector2 paddlePositionRight;
-    Vector2 ballPosition;
-    Vector2 ballVelocity;
+    // Q16.16 game units, so every machine simulates the same bits
+    FixedVector2 paddlePositionLeft;
+    FixedVector2 paddlePositionRight;
+    FixedVector2 ballPosition;
+    // Units per tick
+    FixedVector2 ballVelocity;
     int scoreLeft;
     int scoreRight;
+
+    // xorshift32 state for serves, never 0. Kept in here so a copy of the state replays exactly
+    uint32_t rngState;
+};
+// Snapshots and rollbacks are plain copies
+static_assert(std::is_trivially_copyable_v<GameState>, "GameState must stay trivially copyable");
+
+// What both players do during one tick
+struct GameInputs{
+    // Paddle directions from -FixedOne to FixedOne
+    Fixed left;
+    Fixed right;
+    // Serves or restarts the game
+    bool start;
 };
 
 extern GameState gGameState;
 
+// The simulation advances in ticks of fixed length, independent of the frame rate
+constexpr int SimulationTickRate = 120;
+constexpr double SimulationTickSeconds = 1.0 / SimulationTickRate;
+// After a hitch the simulation drops time beyond this many ticks instead of trying to catch up,
+// otherwise slow ticks make the next frame slower still
+constexpr int MaxTicksPerFrame = 8;
+
 constexpr struct {
     Vector2 paddleSize = {10, 80};
     float paddleSpeed = 50.f;
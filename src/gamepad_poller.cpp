@@ -0,0 +1,226 @@
+#include "gamepad_poller.hpp"
+#include "SDL.h"
+#include <cassert>
+
+#include "logging.h"
+
+static float NormalizeAxis(int16_t value)
+{
+    float normalized = value < 0 ? value / 32768.f : value / 32767.f;
+    float magnitude = normalized < 0 ? -normalized : normalized;
+    if (magnitude < GamepadPoller::Deadzone)
+    {
+        return 0.f;
+    }
+    // Rescale so the output still starts at 0 right outside the deadzone
+    float scaled = (magnitude - GamepadPoller::Deadzone) / (1.f - GamepadPoller::Deadzone);
+    return normalized < 0 ? -scaled : scaled;
+}
+
+bool GamepadPoller::Start(int rateHz /* = 1000 */)
+{
+    assert(rateHz > 0);
+    if (thread != nullptr)
+    {
+        return true;
+    }
+
+    if (!SDL_WasInit(SDL_INIT_GAMECONTROLLER))
+    {
+        LOG(LOG_ERROR, "Gamepad polling needs SDL_INIT_GAMECONTROLLER");
+        return false;
+    }
+
+    // The poll thread updates the joysticks from now on, the event pump must not do it as well
+    SDL_SetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS, "0");
+
+    this->rateHz = rateHz;
+    written.store(0, std::memory_order_relaxed);
+    running.store(true, std::memory_order_relaxed);
+    thread = SDL_CreateThread(ThreadMain, "GamepadPoller", this);
+    if (thread == nullptr)
+    {
+        LOG(LOG_ERROR, "Could not start the gamepad thread");
+        running.store(false, std::memory_order_relaxed);
+        SDL_SetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS, "1");
+        return false;
+    }
+    return true;
+}
+
+void GamepadPoller::Stop()
+{
+    if (thread == nullptr)
+    {
+        return;
+    }
+
+    running.store(false, std::memory_order_relaxed);
+    SDL_WaitThread(thread, nullptr);
+    thread = nullptr;
+
+    for (SDL_GameController*& controller : controllers)
+    {
+        if (controller != nullptr)
+        {
+            SDL_GameControllerClose(controller);
+            controller = nullptr;
+        }
+    }
+    SDL_SetHint(SDL_HINT_AUTO_UPDATE_JOYSTICKS, "1");
+}
+
+void GamepadPoller::OpenControllers()
+{
+    for (SDL_GameController*& controller : controllers)
+    {
+        if (controller != nullptr && !SDL_GameControllerGetAttached(controller))
+        {
+            SDL_GameControllerClose(controller);
+            controller = nullptr;
+        }
+    }
+
+    // Fill free slots with controllers that aren't open yet, in device order
+    int joystickCount = SDL_NumJoysticks();
+    for (int device = 0; device < joystickCount; device++)
+    {
+        if (!SDL_IsGameController(device))
+        {
+            continue;
+        }
+
+        SDL_JoystickID id = SDL_JoystickGetDeviceInstanceID(device);
+        bool open = false;
+        int freeSlot = -1;
+        for (int slot = MaxGamepads - 1; slot >= 0; slot--)
+        {
+            if (controllers[slot] == nullptr)
+            {
+                freeSlot = slot;
+            }
+            else if (SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controllers[slot])) == id)
+            {
+                open = true;
+            }
+        }
+        if (!open && freeSlot >= 0)
+        {
+            controllers[freeSlot] = SDL_GameControllerOpen(device);
+        }
+    }
+}
+
+void GamepadPoller::TakeSample(uint64_t ticks)
+{
+    uint64_t index = written.load(std::memory_order_relaxed);
+    GamepadSample& sample = samples[index % SampleCount];
+    sample.ticks = ticks;
+    sample.connected = 0;
+    for (int gamepad = 0; gamepad < MaxGamepads; gamepad++)
+    {
+        SDL_GameController* controller = controllers[gamepad];
+        for (int axis = 0; axis < SDL_CONTROLLER_AXIS_MAX; axis++)
+        {
+            sample.axes[gamepad][axis] = controller != nullptr ? SDL_GameControllerGetAxis(controller, static_cast<SDL_GameControllerAxis>(axis)) : 0;
+        }
+        if (controller != nullptr)
+        {
+            sample.connected |= 1 << gamepad;
+        }
+    }
+    written.store(index + 1, std::memory_order_release);
+}
+
+int GamepadPoller::ThreadMain(void* userData)
+{
+    GamepadPoller* poller = static_cast<GamepadPoller*>(userData);
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    uint64_t frequency = SDL_GetPerformanceFrequency();
+    uint64_t period = frequency / poller->rateHz;
+    uint64_t next = SDL_GetPerformanceCounter();
+    int lastJoystickCount = -1;
+
+    while (poller->running.load(std::memory_order_relaxed))
+    {
+        // Reads the devices and pushes controller events, which reach the Input event watch on this thread
+        SDL_GameControllerUpdate();
+
+        int joystickCount = SDL_NumJoysticks();
+        if (joystickCount != lastJoystickCount)
+        {
+            poller->OpenControllers();
+            lastJoystickCount = joystickCount;
+        }
+
+        poller->TakeSample(SDL_GetPerformanceCounter());
+
+        // Fixed schedule so the rate doesn't drift, after a long stall start over instead of catching up
+        next += period;
+        uint64_t now = SDL_GetPerformanceCounter();
+        if (now > next + period * 4)
+        {
+            next = now;
+        }
+        if (next > now)
+        {
+            Uint32 milliseconds = static_cast<Uint32>((next - now) * 1000 / frequency);
+            SDL_Delay(milliseconds > 0 ? milliseconds : 1);
+        }
+    }
+    return 0;
+}
+
+bool GamepadPoller::IsConnected(int gamepad) const
+{
+    assert(gamepad >= 0 && gamepad < MaxGamepads);
+    uint64_t count = written.load(std::memory_order_acquire);
+    return count > 0 && (samples[(count - 1) % SampleCount].connected >> gamepad) & 1;
+}
+
+float GamepadPoller::GetAxis(int gamepad, SDL_GameControllerAxis axis) const
+{
+    assert(gamepad >= 0 && gamepad < MaxGamepads);
+    uint64_t count = written.load(std::memory_order_acquire);
+    if (count == 0)
+    {
+        return 0.f;
+    }
+    return NormalizeAxis(samples[(count - 1) % SampleCount].axes[gamepad][axis]);
+}
+
+float GamepadPoller::GetAxisAverage(int gamepad, SDL_GameControllerAxis axis, uint64_t fromTicks, uint64_t toTicks) const
+{
+    assert(gamepad >= 0 && gamepad < MaxGamepads);
+    uint64_t count = written.load(std::memory_order_acquire);
+    if (count == 0)
+    {
+        return 0.f;
+    }
+
+    // Walk back from the newest sample. Only half the ring is read, the writer can't lap
+    // that far while a frame reads it
+    uint64_t oldest = count > SampleCount / 2 ? count - SampleCount / 2 : 0;
+    float sum = 0.f;
+    int taken = 0;
+    for (uint64_t i = count; i > oldest; i--)
+    {
+        const GamepadSample& sample = samples[(i - 1) % SampleCount];
+        if (sample.ticks < fromTicks)
+        {
+            break;
+        }
+        if (sample.ticks <= toTicks)
+        {
+            sum += NormalizeAxis(sample.axes[gamepad][axis]);
+            taken++;
+        }
+    }
+
+    if (taken == 0)
+    {
+        return NormalizeAxis(samples[(count - 1) % SampleCount].axes[gamepad][axis]);
+    }
+    return sum / taken;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#ifndef GAMEPAD_POLLER_HPP
+#define GAMEPAD_POLLER_HPP
+
+#include "SDL_gamecontroller.h"
+#include "SDL_thread.h"
+#include <atomic>
+#include <cstdint>
+
+// Controllers that get sampled, one per paddle
+constexpr int MaxGamepads = 2;
+
+// Analog state of the first MaxGamepads controllers at one instant
+struct GamepadSample{
+    // SDL_GetPerformanceCounter when the sample was taken
+    uint64_t ticks;
+    int16_t axes[MaxGamepads][SDL_CONTROLLER_AXIS_MAX];
+    // Bit per gamepad
+    uint8_t connected;
+};
+
+// Samples game controllers on its own thread at a fixed rate, independent of the frame rate.
+// The thread also drives SDL's joystick updates, so controller button events reach the
+// Input event watch from it instead of from the main thread's event pump.
+// Samples go into a ring the simulation reads by time span, a paddle moves by the average
+// stick position over its frame instead of wherever the stick happened to be when the frame started
+class GamepadPoller
+{
+public:
+    // Two seconds at 1 kHz, readers only look at the last frame or so
+    static constexpr uint32_t SampleCount = 2048;
+    // Stick values closer to the center than this read as 0
+    static constexpr float Deadzone = 0.15f;
+
+private:
+    SDL_Thread* thread = nullptr;
+    std::atomic<bool> running{false};
+    int rateHz = 1000;
+
+    SDL_GameController* controllers[MaxGamepads] = {};
+
+    GamepadSample samples[SampleCount];
+    // Samples ever written, the newest is at (written - 1) % SampleCount
+    std::atomic<uint64_t> written{0};
+
+    static int ThreadMain(void* userData);
+    void OpenControllers();
+    void TakeSample(uint64_t ticks);
+public:
+    GamepadPoller() = default;
+    GamepadPoller(const GamepadPoller&) = delete;
+    GamepadPoller& operator=(const GamepadPoller&) = delete;
+    ~GamepadPoller() { Stop(); }
+
+    // Needs SDL_INIT_GAMECONTROLLER
+    bool Start(int rateHz = 1000);
+    void Stop();
+    bool IsRunning() const { return running.load(std::memory_order_relaxed); }
+
+    bool IsConnected(int gamepad) const;
+    // Newest value of an axis, -1 to 1 with the deadzone applied
+    float GetAxis(int gamepad, SDL_GameControllerAxis axis) const;
+    // Mean of the axis over the samples taken between two SDL_GetPerformanceCounter values,
+    // falls back to the newest sample when none were taken in between
+    float GetAxisAverage(int gamepad, SDL_GameControllerAxis axis, uint64_t fromTicks, uint64_t toTicks) const;
+};
+
+#endif // GAMEPAD_POLLER_HPP
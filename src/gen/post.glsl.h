@@ -0,0 +1,974 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
+
+    Cmdline:
+        sokol-shdc --input shaders\post.glsl --output src\gen\post.glsl.h --slang glsl410:glsl300es
+
+    Overview:
+    =========
+    Shader program: 'post_downsample':
+        Get shader desc: post_downsample_shader_desc(sg_query_backend());
+        Vertex Shader: post_vs
+        Fragment Shader: post_fs_downsample
+    Shader program: 'post_upsample':
+        Get shader desc: post_upsample_shader_desc(sg_query_backend());
+        Vertex Shader: post_vs
+        Fragment Shader: post_fs_upsample
+    Shader program: 'post_composite':
+        Get shader desc: post_composite_shader_desc(sg_query_backend());
+        Vertex Shader: post_vs
+        Fragment Shader: post_fs_composite
+    Bindings:
+        Uniform block 'post_downsample_params':
+            C struct: post_downsample_params_t
+            Bind slot: UB_post_downsample_params => 0
+        Image '_post_source':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__post_source => 0
+        Sampler 'post_smp':
+            Type: SG_SAMPLERTYPE_FILTERING
+            Bind slot: SMP_post_smp => 0
+        Uniform block 'post_upsample_params':
+            C struct: post_upsample_params_t
+            Bind slot: UB_post_upsample_params => 0
+        Uniform block 'post_composite_params':
+            C struct: post_composite_params_t
+            Bind slot: UB_post_composite_params => 0
+        Image '_post_scene':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__post_scene => 0
+        Image '_post_bloom':
+            Image type: SG_IMAGETYPE_2D
+            Sample type: SG_IMAGESAMPLETYPE_FLOAT
+            Multisampled: false
+            Bind slot: IMG__post_bloom => 1
+*/
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before post.glsl.h"
+#endif
+#if !defined(SOKOL_SHDC_ALIGN)
+#if defined(_MSC_VER)
+#define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+#else
+#define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+#endif
+#endif
+#define UB_post_downsample_params (0)
+#define IMG__post_source (0)
+#define SMP_post_smp (0)
+#define UB_post_upsample_params (0)
+#define UB_post_composite_params (0)
+#define IMG__post_scene (0)
+#define IMG__post_bloom (1)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct post_downsample_params_t {
+    float texel_size[2];
+    float threshold;
+    float knee;
+} post_downsample_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct post_upsample_params_t {
+    float texel_size[2];
+    float radius;
+    float intensity;
+} post_upsample_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct post_composite_params_t {
+    float resolution[2];
+    float bloom_intensity;
+    float crt_enabled;
+    float scanline_strength;
+    float vignette_strength;
+    float curvature;
+    float _unused;
+} post_composite_params_t;
+#pragma pack(pop)
+/*
+    #version 410
+
+    layout(location = 0) out vec2 uv;
+
+    void main()
+    {
+        vec2 _position = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+        uv = _position;
+        gl_Position = vec4((_position * 2.0) - vec2(1.0), 0.0, 1.0);
+    }
+
+*/
+static const uint8_t post_vs_source_glsl410[234] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,
+    0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,
+    0x29,0x20,0x26,0x20,0x32,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,
+    0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x32,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x28,0x5f,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform vec4 post_downsample_params[1];
+    uniform sampler2D _post_source_post_smp;
+
+    layout(location = 0) in vec2 uv;
+    layout(location = 0) out vec4 frag_color;
+
+    void main()
+    {
+        vec3 c = texture(_post_source_post_smp, uv + vec2(-post_downsample_params[0].x, -post_downsample_params[0].y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(post_downsample_params[0].x, -post_downsample_params[0].y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(-post_downsample_params[0].x, post_downsample_params[0].y)).xyz;
+        c += texture(_post_source_post_smp, uv + post_downsample_params[0].xy).xyz;
+        c *= 0.25;
+        if (post_downsample_params[0].w > 0.0)
+        {
+            float brightness = max(c.x, max(c.y, c.z));
+            float soft = clamp((brightness - post_downsample_params[0].z) + post_downsample_params[0].w, 0.0, 2.0 * post_downsample_params[0].w);
+            soft = (soft * soft) / ((4.0 * post_downsample_params[0].w) + 9.9999997473787516355514526367188e-06);
+            c *= (max(soft, brightness - post_downsample_params[0].z) / max(brightness, 9.9999997473787516355514526367188e-06));
+        }
+        frag_color = vec4(c, 1.0);
+    }
+
+*/
+static const uint8_t post_fs_downsample_source_glsl410[1150] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,
+    0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x2d,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,0x2d,0x70,
+    0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,
+    0x20,0x2d,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,
+    0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,
+    0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,
+    0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,
+    0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x75,0x76,0x20,0x2b,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2a,0x3d,
+    0x20,0x30,0x2e,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x70,
+    0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x30,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x63,0x2e,0x78,0x2c,0x20,0x6d,0x61,0x78,0x28,
+    0x63,0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6f,0x66,0x74,0x20,0x3d,
+    0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,
+    0x73,0x73,0x20,0x2d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,
+    0x29,0x20,0x2b,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,
+    0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x6f,0x66,0x74,0x20,0x3d,0x20,0x28,0x73,0x6f,0x66,0x74,0x20,0x2a,
+    0x20,0x73,0x6f,0x66,0x74,0x29,0x20,0x2f,0x20,0x28,0x28,0x34,0x2e,0x30,0x20,0x2a,
+    0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x29,0x20,0x2b,0x20,
+    0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,
+    0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,
+    0x38,0x65,0x2d,0x30,0x36,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x2a,0x3d,0x20,0x28,0x6d,0x61,0x78,0x28,0x73,0x6f,0x66,0x74,0x2c,0x20,
+    0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x2d,0x20,0x70,0x6f,0x73,
+    0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x29,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,
+    0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x2c,0x20,0x39,0x2e,0x39,0x39,
+    0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,
+    0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,
+    0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x63,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform vec4 post_upsample_params[1];
+    uniform sampler2D _post_source_post_smp;
+
+    layout(location = 0) in vec2 uv;
+    layout(location = 0) out vec4 frag_color;
+
+    void main()
+    {
+        vec2 o = post_upsample_params[0].xy * post_upsample_params[0].z;
+        vec3 c = texture(_post_source_post_smp, uv).xyz * 4.0;
+        c += (texture(_post_source_post_smp, uv + vec2(-o.x, 0.0)).xyz * 2.0);
+        c += (texture(_post_source_post_smp, uv + vec2(o.x, 0.0)).xyz * 2.0);
+        c += (texture(_post_source_post_smp, uv + vec2(0.0, -o.y)).xyz * 2.0);
+        c += (texture(_post_source_post_smp, uv + vec2(0.0, o.y)).xyz * 2.0);
+        c += texture(_post_source_post_smp, uv + vec2(-o.x, -o.y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(o.x, -o.y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(-o.x, o.y)).xyz;
+        c += texture(_post_source_post_smp, uv + o).xyz;
+        frag_color = vec4(c * (post_upsample_params[0].w * 0.0625), 1.0);
+    }
+
+*/
+static const uint8_t post_fs_upsample_source_glsl410[939] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,
+    0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x6f,0x20,0x3d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,
+    0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,
+    0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,
+    0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,
+    0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x6f,0x2e,0x78,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x28,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x6f,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x20,0x2b,0x3d,0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x2d,0x6f,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,
+    0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,
+    0x6f,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x2d,0x6f,0x2e,0x78,0x2c,0x20,0x2d,0x6f,0x2e,0x79,0x29,0x29,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x6f,0x2e,0x78,0x2c,0x20,0x2d,0x6f,0x2e,
+    0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x6f,0x2e,0x78,0x2c,
+    0x20,0x6f,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,
+    0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x6f,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x20,0x2a,0x20,0x28,0x70,0x6f,0x73,0x74,
+    0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x77,0x20,0x2a,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x29,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 410
+
+    uniform vec4 post_composite_params[2];
+    uniform sampler2D _post_scene_post_smp;
+    uniform sampler2D _post_bloom_post_smp;
+
+    layout(location = 0) in vec2 uv;
+    layout(location = 0) out vec4 frag_color;
+
+    void main()
+    {
+        vec2 screen_uv = uv;
+        if (post_composite_params[0].w > 0.5)
+        {
+            vec2 centered = (uv * 2.0) - vec2(1.0);
+            centered *= (1.0 + (post_composite_params[1].z * dot(centered.yx, centered.yx)));
+            screen_uv = (centered * 0.5) + vec2(0.5);
+            if ((((screen_uv.x < 0.0) || (screen_uv.x > 1.0)) || (screen_uv.y < 0.0)) || (screen_uv.y > 1.0))
+            {
+                frag_color = vec4(0.0, 0.0, 0.0, 1.0);
+                return;
+            }
+        }
+        vec3 c = texture(_post_scene_post_smp, screen_uv).xyz;
+        c += (texture(_post_bloom_post_smp, screen_uv).xyz * post_composite_params[0].z);
+        if (post_composite_params[0].w > 0.5)
+        {
+            c *= (1.0 - (post_composite_params[1].x * (0.5 + (0.5 * sin((screen_uv.y * post_composite_params[0].y) * 3.1415927410125732421875)))));
+            vec2 edge = screen_uv * (vec2(1.0) - screen_uv);
+            c *= mix(1.0, pow((edge.x * edge.y) * 16.0, 0.25), post_composite_params[1].y);
+        }
+        frag_color = vec4(c, 1.0);
+    }
+
+*/
+static const uint8_t post_fs_composite_source_glsl410[1211] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x32,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x63,0x65,
+    0x6e,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x62,0x6c,0x6f,0x6f,0x6d,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,
+    0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,0x20,0x3d,
+    0x20,0x28,0x75,0x76,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,0x20,0x2a,0x3d,0x20,0x28,0x31,0x2e,
+    0x30,0x20,0x2b,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,
+    0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,0x20,
+    0x2a,0x20,0x64,0x6f,0x74,0x28,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,0x2e,0x79,
+    0x78,0x2c,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,0x2e,0x79,0x78,0x29,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x20,0x3d,0x20,0x28,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,
+    0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x28,0x28,0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2e,0x78,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x29,0x20,0x7c,0x7c,0x20,0x28,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x2e,0x78,0x20,0x3e,0x20,0x31,0x2e,0x30,0x29,0x29,0x20,0x7c,
+    0x7c,0x20,0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2e,0x79,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x2e,0x79,0x20,0x3e,0x20,0x31,0x2e,0x30,0x29,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x63,0x65,0x6e,0x65,
+    0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x2b,0x3d,0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,
+    0x73,0x74,0x5f,0x62,0x6c,0x6f,0x6f,0x6d,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,
+    0x70,0x2c,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,
+    0x7a,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,
+    0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x2a,0x3d,0x20,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,
+    0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,
+    0x20,0x2a,0x20,0x28,0x30,0x2e,0x35,0x20,0x2b,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,
+    0x20,0x73,0x69,0x6e,0x28,0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2e,
+    0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,
+    0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x20,
+    0x2a,0x20,0x33,0x2e,0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,
+    0x35,0x37,0x33,0x32,0x34,0x32,0x31,0x38,0x37,0x35,0x29,0x29,0x29,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x65,0x64,
+    0x67,0x65,0x20,0x3d,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x20,0x2a,
+    0x20,0x28,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,0x73,0x63,
+    0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x2a,0x3d,0x20,0x6d,0x69,0x78,0x28,0x31,0x2e,0x30,0x2c,0x20,
+    0x70,0x6f,0x77,0x28,0x28,0x65,0x64,0x67,0x65,0x2e,0x78,0x20,0x2a,0x20,0x65,0x64,
+    0x67,0x65,0x2e,0x79,0x29,0x20,0x2a,0x20,0x31,0x36,0x2e,0x30,0x2c,0x20,0x30,0x2e,
+    0x32,0x35,0x29,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,
+    0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+
+    out vec2 uv;
+
+    void main()
+    {
+        vec2 _position = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+        uv = _position;
+        gl_Position = vec4((_position * 2.0) - vec2(1.0), 0.0, 1.0);
+    }
+
+*/
+static const uint8_t post_vs_source_glsl300es[216] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x28,0x67,0x6c,
+    0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x3c,0x3c,0x20,0x31,0x29,0x20,
+    0x26,0x20,0x32,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x67,0x6c,0x5f,0x56,
+    0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x26,0x20,0x32,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x28,0x5f,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_downsample_params[1];
+    uniform highp sampler2D _post_source_post_smp;
+
+    in highp vec2 uv;
+    layout(location = 0) out highp vec4 frag_color;
+
+    void main()
+    {
+        highp vec3 c = texture(_post_source_post_smp, uv + vec2(-post_downsample_params[0].x, -post_downsample_params[0].y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(post_downsample_params[0].x, -post_downsample_params[0].y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(-post_downsample_params[0].x, post_downsample_params[0].y)).xyz;
+        c += texture(_post_source_post_smp, uv + post_downsample_params[0].xy).xyz;
+        c *= 0.25;
+        if (post_downsample_params[0].w > 0.0)
+        {
+            highp float brightness = max(c.x, max(c.y, c.z));
+            highp float soft = clamp((brightness - post_downsample_params[0].z) + post_downsample_params[0].w, 0.0, 2.0 * post_downsample_params[0].w);
+            soft = (soft * soft) / ((4.0 * post_downsample_params[0].w) + 9.9999997473787516355514526367188e-06);
+            c *= (max(soft, brightness - post_downsample_params[0].z) / max(brightness, 9.9999997473787516355514526367188e-06));
+        }
+        frag_color = vec4(c, 1.0);
+    }
+
+*/
+static const uint8_t post_fs_downsample_source_glsl300es[1220] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,
+    0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x32,0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,
+    0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,
+    0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x70,0x6f,0x73,0x74,0x5f,
+    0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,0x2d,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,
+    0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,
+    0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x70,0x6f,
+    0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,0x2d,0x70,0x6f,0x73,0x74,
+    0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,
+    0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x2d,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x2c,0x20,0x70,
+    0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x70,
+    0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x29,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2a,0x3d,0x20,0x30,0x2e,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,
+    0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x63,0x2e,0x78,0x2c,0x20,0x6d,0x61,0x78,0x28,
+    0x63,0x2e,0x79,0x2c,0x20,0x63,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x6f,0x66,0x74,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x62,0x72,
+    0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,0x20,0x2d,0x20,0x70,0x6f,0x73,0x74,0x5f,
+    0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x29,0x20,0x2b,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,
+    0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x77,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x20,
+    0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x6f,0x66,0x74,0x20,0x3d,0x20,0x28,
+    0x73,0x6f,0x66,0x74,0x20,0x2a,0x20,0x73,0x6f,0x66,0x74,0x29,0x20,0x2f,0x20,0x28,
+    0x28,0x34,0x2e,0x30,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,
+    0x2e,0x77,0x29,0x20,0x2b,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,
+    0x37,0x33,0x37,0x38,0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,
+    0x36,0x33,0x36,0x37,0x31,0x38,0x38,0x65,0x2d,0x30,0x36,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x2a,0x3d,0x20,0x28,0x6d,0x61,0x78,0x28,
+    0x73,0x6f,0x66,0x74,0x2c,0x20,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,
+    0x20,0x2d,0x20,0x70,0x6f,0x73,0x74,0x5f,0x64,0x6f,0x77,0x6e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x29,0x20,
+    0x2f,0x20,0x6d,0x61,0x78,0x28,0x62,0x72,0x69,0x67,0x68,0x74,0x6e,0x65,0x73,0x73,
+    0x2c,0x20,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x39,0x37,0x34,0x37,0x33,0x37,0x38,
+    0x37,0x35,0x31,0x36,0x33,0x35,0x35,0x35,0x31,0x34,0x35,0x32,0x36,0x33,0x36,0x37,
+    0x31,0x38,0x38,0x65,0x2d,0x30,0x36,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_upsample_params[1];
+    uniform highp sampler2D _post_source_post_smp;
+
+    in highp vec2 uv;
+    layout(location = 0) out highp vec4 frag_color;
+
+    void main()
+    {
+        highp vec2 o = post_upsample_params[0].xy * post_upsample_params[0].z;
+        highp vec3 c = texture(_post_source_post_smp, uv).xyz * 4.0;
+        c += (texture(_post_source_post_smp, uv + vec2(-o.x, 0.0)).xyz * 2.0);
+        c += (texture(_post_source_post_smp, uv + vec2(o.x, 0.0)).xyz * 2.0);
+        c += (texture(_post_source_post_smp, uv + vec2(0.0, -o.y)).xyz * 2.0);
+        c += (texture(_post_source_post_smp, uv + vec2(0.0, o.y)).xyz * 2.0);
+        c += texture(_post_source_post_smp, uv + vec2(-o.x, -o.y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(o.x, -o.y)).xyz;
+        c += texture(_post_source_post_smp, uv + vec2(-o.x, o.y)).xyz;
+        c += texture(_post_source_post_smp, uv + o).xyz;
+        frag_color = vec4(c * (post_upsample_params[0].w * 0.0625), 1.0);
+    }
+
+*/
+static const uint8_t post_fs_upsample_source_glsl300es[1003] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,
+    0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x6f,0x20,0x3d,0x20,0x70,
+    0x6f,0x73,0x74,0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x70,0x6f,0x73,0x74,
+    0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,
+    0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,
+    0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,
+    0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x6f,0x2e,0x78,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x28,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,
+    0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x6f,0x2e,0x78,0x2c,0x20,0x30,0x2e,0x30,0x29,0x29,
+    0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x20,0x2b,0x3d,0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,
+    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x2d,0x6f,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,
+    0x2a,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,
+    0x20,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x2c,0x20,
+    0x6f,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x2d,0x6f,0x2e,0x78,0x2c,0x20,0x2d,0x6f,0x2e,0x79,0x29,0x29,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6f,0x75,
+    0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x6f,0x2e,0x78,0x2c,0x20,0x2d,0x6f,0x2e,
+    0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,
+    0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x6f,0x2e,0x78,0x2c,
+    0x20,0x6f,0x2e,0x79,0x29,0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x2b,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,
+    0x73,0x74,0x5f,0x73,0x6f,0x75,0x72,0x63,0x65,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,
+    0x6d,0x70,0x2c,0x20,0x75,0x76,0x20,0x2b,0x20,0x6f,0x29,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x20,0x2a,0x20,0x28,0x70,0x6f,0x73,0x74,
+    0x5f,0x75,0x70,0x73,0x61,0x6d,0x70,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x77,0x20,0x2a,0x20,0x30,0x2e,0x30,0x36,0x32,0x35,0x29,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+
+    uniform highp vec4 post_composite_params[2];
+    uniform highp sampler2D _post_scene_post_smp;
+    uniform highp sampler2D _post_bloom_post_smp;
+
+    in highp vec2 uv;
+    layout(location = 0) out highp vec4 frag_color;
+
+    void main()
+    {
+        highp vec2 screen_uv = uv;
+        if (post_composite_params[0].w > 0.5)
+        {
+            highp vec2 centered = (uv * 2.0) - vec2(1.0);
+            centered *= (1.0 + (post_composite_params[1].z * dot(centered.yx, centered.yx)));
+            screen_uv = (centered * 0.5) + vec2(0.5);
+            if ((((screen_uv.x < 0.0) || (screen_uv.x > 1.0)) || (screen_uv.y < 0.0)) || (screen_uv.y > 1.0))
+            {
+                frag_color = vec4(0.0, 0.0, 0.0, 1.0);
+                return;
+            }
+        }
+        highp vec3 c = texture(_post_scene_post_smp, screen_uv).xyz;
+        c += (texture(_post_bloom_post_smp, screen_uv).xyz * post_composite_params[0].z);
+        if (post_composite_params[0].w > 0.5)
+        {
+            c *= (1.0 - (post_composite_params[1].x * (0.5 + (0.5 * sin((screen_uv.y * post_composite_params[0].y) * 3.1415927410125732421875)))));
+            highp vec2 edge = screen_uv * (vec2(1.0) - screen_uv);
+            c *= mix(1.0, pow((edge.x * edge.y) * 16.0, 0.25), post_composite_params[1].y);
+        }
+        frag_color = vec4(c, 1.0);
+    }
+
+*/
+static const uint8_t post_fs_composite_source_glsl300es[1293] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,
+    0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x32,0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,
+    0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,
+    0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,
+    0x44,0x20,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x62,0x6c,0x6f,0x6f,0x6d,0x5f,0x70,0x6f,
+    0x73,0x74,0x5f,0x73,0x6d,0x70,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,
+    0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,
+    0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x65,0x6e,0x74,
+    0x65,0x72,0x65,0x64,0x20,0x3d,0x20,0x28,0x75,0x76,0x20,0x2a,0x20,0x32,0x2e,0x30,
+    0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,0x64,0x20,
+    0x2a,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2b,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,
+    0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x7a,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x63,0x65,0x6e,0x74,
+    0x65,0x72,0x65,0x64,0x2e,0x79,0x78,0x2c,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x65,
+    0x64,0x2e,0x79,0x78,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x20,0x3d,0x20,0x28,0x63,0x65,
+    0x6e,0x74,0x65,0x72,0x65,0x64,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x28,0x28,0x73,0x63,0x72,0x65,0x65,0x6e,
+    0x5f,0x75,0x76,0x2e,0x78,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,0x20,0x7c,0x7c,0x20,
+    0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2e,0x78,0x20,0x3e,0x20,0x31,
+    0x2e,0x30,0x29,0x29,0x20,0x7c,0x7c,0x20,0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,
+    0x75,0x76,0x2e,0x79,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,0x29,0x20,0x7c,0x7c,0x20,
+    0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2e,0x79,0x20,0x3e,0x20,0x31,
+    0x2e,0x30,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x63,0x65,0x6e,0x65,0x5f,0x70,0x6f,0x73,
+    0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,
+    0x29,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x2b,0x3d,0x20,
+    0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x62,
+    0x6c,0x6f,0x6f,0x6d,0x5f,0x70,0x6f,0x73,0x74,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x73,
+    0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x29,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,
+    0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x77,0x20,
+    0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x2a,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x28,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x20,0x2a,0x20,0x28,
+    0x30,0x2e,0x35,0x20,0x2b,0x20,0x28,0x30,0x2e,0x35,0x20,0x2a,0x20,0x73,0x69,0x6e,
+    0x28,0x28,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2e,0x79,0x20,0x2a,0x20,
+    0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x79,0x29,0x20,0x2a,0x20,0x33,0x2e,
+    0x31,0x34,0x31,0x35,0x39,0x32,0x37,0x34,0x31,0x30,0x31,0x32,0x35,0x37,0x33,0x32,
+    0x34,0x32,0x31,0x38,0x37,0x35,0x29,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x65,0x64,0x67,0x65,0x20,0x3d,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,
+    0x20,0x2a,0x20,0x28,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x63,0x20,0x2a,0x3d,0x20,0x6d,0x69,0x78,0x28,0x31,0x2e,0x30,
+    0x2c,0x20,0x70,0x6f,0x77,0x28,0x28,0x65,0x64,0x67,0x65,0x2e,0x78,0x20,0x2a,0x20,
+    0x65,0x64,0x67,0x65,0x2e,0x79,0x29,0x20,0x2a,0x20,0x31,0x36,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x32,0x35,0x29,0x2c,0x20,0x70,0x6f,0x73,0x74,0x5f,0x63,0x6f,0x6d,0x70,
+    0x6f,0x73,0x69,0x74,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,
+    0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
+    0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x63,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+static inline const sg_shader_desc* post_downsample_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)post_vs_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)post_fs_downsample_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_downsample_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_post_source_post_smp";
+            desc.label = "post_downsample_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)post_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)post_fs_downsample_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_downsample_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_post_source_post_smp";
+            desc.label = "post_downsample_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_upsample_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)post_vs_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)post_fs_upsample_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_upsample_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_post_source_post_smp";
+            desc.label = "post_upsample_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)post_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)post_fs_upsample_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 16;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 1;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_upsample_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_post_source_post_smp";
+            desc.label = "post_upsample_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
+static inline const sg_shader_desc* post_composite_shader_desc(sg_backend backend) {
+    if (backend == SG_BACKEND_GLCORE) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)post_vs_source_glsl410;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)post_fs_composite_source_glsl410;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_composite_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_post_scene_post_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_post_bloom_post_smp";
+            desc.label = "post_composite_shader";
+        }
+        return &desc;
+    }
+    if (backend == SG_BACKEND_GLES3) {
+        static sg_shader_desc desc;
+        static bool valid;
+        if (!valid) {
+            valid = true;
+            desc.vertex_func.source = (const char*)post_vs_source_glsl300es;
+            desc.vertex_func.entry = "main";
+            desc.fragment_func.source = (const char*)post_fs_composite_source_glsl300es;
+            desc.fragment_func.entry = "main";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 32;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 2;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "post_composite_params";
+            desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[0].image_type = SG_IMAGETYPE_2D;
+            desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[0].multisampled = false;
+            desc.images[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.images[1].image_type = SG_IMAGETYPE_2D;
+            desc.images[1].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
+            desc.images[1].multisampled = false;
+            desc.samplers[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.samplers[0].sampler_type = SG_SAMPLERTYPE_FILTERING;
+            desc.image_sampler_pairs[0].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[0].image_slot = 0;
+            desc.image_sampler_pairs[0].sampler_slot = 0;
+            desc.image_sampler_pairs[0].glsl_name = "_post_scene_post_smp";
+            desc.image_sampler_pairs[1].stage = SG_SHADERSTAGE_FRAGMENT;
+            desc.image_sampler_pairs[1].image_slot = 1;
+            desc.image_sampler_pairs[1].sampler_slot = 0;
+            desc.image_sampler_pairs[1].glsl_name = "_post_bloom_post_smp";
+            desc.label = "post_composite_shader";
+        }
+        return &desc;
+    }
+    return 0;
+}
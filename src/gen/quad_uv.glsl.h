@@ -19,6 +19,9 @@
             ATTR_quad_uv_bytes0 => 2
             ATTR_quad_uv_texcoord0 => 3
     Bindings:
+        Uniform block 'vs_params':
+            C struct: vs_params_t
+            Bind slot: UB_vs_params => 0
         Image '_texture0':
             Image type: SG_IMAGETYPE_2D
             Sample type: SG_IMAGESAMPLETYPE_FLOAT
@@ -42,53 +45,89 @@
 #define ATTR_quad_uv_color0 (1)
 #define ATTR_quad_uv_bytes0 (2)
 #define ATTR_quad_uv_texcoord0 (3)
+#define UB_vs_params (0)
 #define IMG__texture0 (0)
 #define SMP_texture0_smp (1)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    float transforms[192][4];
+} vs_params_t;
+#pragma pack(pop)
 /*
     #version 410
 
+    uniform vec4 vs_params[192];
+    layout(location = 2) in vec4 bytes0;
     layout(location = 0) in vec4 position;
     layout(location = 0) out vec4 color;
     layout(location = 1) in vec4 color0;
     layout(location = 1) out vec2 uv;
     layout(location = 3) in vec2 texcoord0;
     layout(location = 2) out vec4 bytes;
-    layout(location = 2) in vec4 bytes0;
+    layout(location = 3) out vec4 clip_distances;
 
     void main()
     {
-        gl_Position = position;
+        int _24 = int((bytes0.y * 255.0) + 0.5) * 3;
+        vec3 _52 = vec3(position.xy, 1.0);
+        gl_Position = vec4(dot(vs_params[_24].xyz, _52), dot(vs_params[_24 + 1].xyz, _52), (position.z * vs_params[_24].w) + vs_params[_24 + 1].w, 1.0);
+        clip_distances = vec4(gl_Position.xy - vs_params[_24 + 2].xy, vs_params[_24 + 2].zw - gl_Position.xy);
         color = color0;
         uv = texcoord0;
         bytes = bytes0;
     }
 
 */
-static const uint8_t vs_source_glsl410[382] = {
-    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x6c,0x61,
-    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
-    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,
-    0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
-    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
-    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x6c,
-    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
-    0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,
+static const uint8_t vs_source_glsl410[773] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x39,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,
     0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,
-    0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
-    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x6f,0x75,
-    0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,0x6c,0x61,
-    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-    0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,
-    0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x74,0x65,0x78,0x63,0x6f,
-    0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x79,0x74,0x65,0x73,0x20,
-    0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x33,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6c,
+    0x69,0x70,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x5f,0x32,0x34,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x28,
+    0x62,0x79,0x74,0x65,0x73,0x30,0x2e,0x79,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,
+    0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2a,0x20,0x33,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x32,0x20,0x3d,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x5d,0x2e,0x78,
+    0x79,0x7a,0x2c,0x20,0x5f,0x35,0x32,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x20,0x2b,0x20,0x31,0x5d,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x35,0x32,0x29,0x2c,0x20,0x28,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x2a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x5d,0x2e,0x77,0x29,0x20,0x2b,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x20,0x2b,0x20,0x31,0x5d,
+    0x2e,0x77,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6c,
+    0x69,0x70,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x78,0x79,0x20,0x2d,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,
+    0x32,0x34,0x20,0x2b,0x20,0x32,0x5d,0x2e,0x78,0x79,0x2c,0x20,0x76,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x20,0x2b,0x20,0x32,0x5d,0x2e,0x7a,
+    0x77,0x20,0x2d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x78,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 410
@@ -99,21 +138,38 @@ static const uint8_t vs_source_glsl410[382] = {
     layout(location = 1) in vec2 uv;
     layout(location = 0) out vec4 frag_color;
     layout(location = 0) in vec4 color;
+    layout(location = 3) in vec4 clip_distances;
 
     void main()
     {
+        if (any(lessThan(clip_distances, vec4(0.0))))
+        {
+            discard;
+        }
+        int _12 = int((bytes.x * 255.0) + 0.5);
         vec4 texture_color = vec4(1.0);
-        if (int(bytes.x * 255.0) == 0)
+        if (_12 == 0)
         {
             vec4 _56 = texture_color;
             _56.w = texture(_texture0_texture0_smp, uv).x;
             texture_color = _56;
         }
+        else
+        {
+            if (_12 == 1)
+            {
+                float _70 = texture(_texture0_texture0_smp, uv).x;
+                float _73 = fwidth(_70);
+                vec4 _81 = texture_color;
+                _81.w = smoothstep(0.5 - _73, 0.5 + _73, _70);
+                texture_color = _81;
+            }
+        }
         frag_color = texture_color * color;
     }
 
 */
-static const uint8_t fs_source_glsl410[464] = {
+static const uint8_t fs_source_glsl410[908] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x34,0x31,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
     0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
@@ -126,67 +182,122 @@ static const uint8_t fs_source_glsl410[464] = {
     0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,
     0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
     0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
-    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,
-    0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,0x28,0x62,0x79,0x74,0x65,0x73,
-    0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x20,0x3d,0x3d,0x20,0x30,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x5f,0x35,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
-    0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x5f,0x35,0x36,0x2e,0x77,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x30,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
-    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x35,0x36,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
-
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6c,0x69,0x70,0x5f,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x61,0x6e,0x79,0x28,0x6c,0x65,0x73,0x73,0x54,0x68,0x61,0x6e,0x28,0x63,0x6c,0x69,
+    0x70,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x2c,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x5f,
+    0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x2e,
+    0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x31,0x32,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x35,0x36,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x2e,0x77,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x73,0x6d,0x70,0x2c,
+    0x20,0x75,0x76,0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x5f,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x32,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x37,0x30,0x20,
+    0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x73,0x6d,0x70,
+    0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x37,0x33,0x20,0x3d,
+    0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x5f,0x37,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,
+    0x38,0x31,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x38,0x31,0x2e,0x77,0x20,0x3d,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,
+    0x65,0x70,0x28,0x30,0x2e,0x35,0x20,0x2d,0x20,0x5f,0x37,0x33,0x2c,0x20,0x30,0x2e,
+    0x35,0x20,0x2b,0x20,0x5f,0x37,0x33,0x2c,0x20,0x5f,0x37,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x38,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
 
+    uniform vec4 vs_params[192];
+    layout(location = 2) in vec4 bytes0;
     layout(location = 0) in vec4 position;
     out vec4 color;
     layout(location = 1) in vec4 color0;
     out vec2 uv;
     layout(location = 3) in vec2 texcoord0;
     out vec4 bytes;
-    layout(location = 2) in vec4 bytes0;
+    out vec4 clip_distances;
 
     void main()
     {
-        gl_Position = position;
+        int _24 = int((bytes0.y * 255.0) + 0.5) * 3;
+        vec3 _52 = vec3(position.xy, 1.0);
+        gl_Position = vec4(dot(vs_params[_24].xyz, _52), dot(vs_params[_24 + 1].xyz, _52), (position.z * vs_params[_24].w) + vs_params[_24 + 1].w, 1.0);
+        clip_distances = vec4(gl_Position.xy - vs_params[_24 + 2].xy, vs_params[_24 + 2].zw - gl_Position.xy);
         color = color0;
         uv = texcoord0;
         bytes = bytes0;
     }
 
 */
-static const uint8_t vs_source_glsl300es[322] = {
+static const uint8_t vs_source_glsl300es[692] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
-    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x6f,
-    0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
-    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
-    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x6f,0x75,0x74,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
-    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,
-    0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,
-    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,
-    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
-    0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x62,
-    0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
-    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x74,
-    0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x79,
-    0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x00,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x39,0x32,0x5d,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,0x65,0x73,
+    0x30,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
+    0x64,0x30,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x79,0x74,
+    0x65,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6c,0x69,
+    0x70,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x3b,0x0a,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x74,0x20,0x5f,0x32,0x34,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x28,0x62,
+    0x79,0x74,0x65,0x73,0x30,0x2e,0x79,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,
+    0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2a,0x20,0x33,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x35,0x32,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x5d,0x2e,0x78,0x79,
+    0x7a,0x2c,0x20,0x5f,0x35,0x32,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x20,0x2b,0x20,0x31,0x5d,0x2e,
+    0x78,0x79,0x7a,0x2c,0x20,0x5f,0x35,0x32,0x29,0x2c,0x20,0x28,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2e,0x7a,0x20,0x2a,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x5f,0x32,0x34,0x5d,0x2e,0x77,0x29,0x20,0x2b,0x20,0x76,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x20,0x2b,0x20,0x31,0x5d,0x2e,
+    0x77,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6c,0x69,
+    0x70,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,
+    0x79,0x20,0x2d,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,
+    0x34,0x20,0x2b,0x20,0x32,0x5d,0x2e,0x78,0x79,0x2c,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x5f,0x32,0x34,0x20,0x2b,0x20,0x32,0x5d,0x2e,0x7a,0x77,
+    0x20,0x2d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,
+    0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x62,0x79,0x74,0x65,0x73,0x30,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
@@ -199,21 +310,38 @@ static const uint8_t vs_source_glsl300es[322] = {
     in highp vec2 uv;
     layout(location = 0) out highp vec4 frag_color;
     in highp vec4 color;
+    in highp vec4 clip_distances;
 
     void main()
     {
+        if (any(lessThan(clip_distances, vec4(0.0))))
+        {
+            discard;
+        }
+        int _12 = int((bytes.x * 255.0) + 0.5);
         highp vec4 texture_color = vec4(1.0);
-        if (int(bytes.x * 255.0) == 0)
+        if (_12 == 0)
         {
             highp vec4 _56 = texture_color;
             _56.w = texture(_texture0_texture0_smp, uv).x;
             texture_color = _56;
         }
+        else
+        {
+            if (_12 == 1)
+            {
+                highp float _70 = texture(_texture0_texture0_smp, uv).x;
+                highp float _73 = fwidth(_70);
+                highp vec4 _81 = texture_color;
+                _81.w = smoothstep(0.5 - _73, 0.5 + _73, _70);
+                texture_color = _81;
+            }
+        }
         frag_color = texture_color * color;
     }
 
 */
-static const uint8_t fs_source_glsl300es[492] = {
+static const uint8_t fs_source_glsl300es[939] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
     0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
@@ -227,24 +355,52 @@ static const uint8_t fs_source_glsl300es[492] = {
     0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
     0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x5f,
     0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
-    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,
-    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x74,
-    0x28,0x62,0x79,0x74,0x65,0x73,0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,
-    0x29,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
-    0x20,0x5f,0x35,0x36,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,
-    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x36,0x2e,0x77,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,
-    0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,
-    0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,
-    0x6f,0x72,0x20,0x3d,0x20,0x5f,0x35,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
-    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,
-    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,0x6e,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6c,0x69,0x70,0x5f,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x61,0x6e,0x79,0x28,0x6c,0x65,0x73,0x73,0x54,0x68,0x61,0x6e,0x28,0x63,0x6c,
+    0x69,0x70,0x5f,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x73,0x2c,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x5f,0x31,0x32,0x20,0x3d,0x20,0x69,0x6e,0x74,0x28,0x28,0x62,0x79,0x74,0x65,0x73,
+    0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x29,0x20,0x2b,0x20,0x30,0x2e,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x32,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x35,0x36,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x2e,0x77,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,
+    0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x35,0x36,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x31,0x32,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x37,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x30,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x30,0x5f,
+    0x73,0x6d,0x70,0x2c,0x20,0x75,0x76,0x29,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x37,0x33,0x20,0x3d,0x20,0x66,0x77,0x69,0x64,0x74,0x68,
+    0x28,0x5f,0x37,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x38,
+    0x31,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x38,0x31,0x2e,0x77,0x20,0x3d,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,
+    0x70,0x28,0x30,0x2e,0x35,0x20,0x2d,0x20,0x5f,0x37,0x33,0x2c,0x20,0x30,0x2e,0x35,
+    0x20,0x2b,0x20,0x5f,0x37,0x33,0x2c,0x20,0x5f,0x37,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x38,0x31,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 static inline const sg_shader_desc* quad_uv_shader_desc(sg_backend backend) {
     if (backend == SG_BACKEND_GLCORE) {
@@ -260,6 +416,12 @@ static inline const sg_shader_desc* quad_uv_shader_desc(sg_backend backend) {
             desc.attrs[1].glsl_name = "color0";
             desc.attrs[2].glsl_name = "bytes0";
             desc.attrs[3].glsl_name = "texcoord0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 3072;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
@@ -287,6 +449,12 @@ static inline const sg_shader_desc* quad_uv_shader_desc(sg_backend backend) {
             desc.attrs[1].glsl_name = "color0";
             desc.attrs[2].glsl_name = "bytes0";
             desc.attrs[3].glsl_name = "texcoord0";
+            desc.uniform_blocks[0].stage = SG_SHADERSTAGE_VERTEX;
+            desc.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+            desc.uniform_blocks[0].size = 3072;
+            desc.uniform_blocks[0].glsl_uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+            desc.uniform_blocks[0].glsl_uniforms[0].array_count = 192;
+            desc.uniform_blocks[0].glsl_uniforms[0].glsl_name = "vs_params";
             desc.images[0].stage = SG_SHADERSTAGE_FRAGMENT;
             desc.images[0].image_type = SG_IMAGETYPE_2D;
             desc.images[0].sample_type = SG_IMAGESAMPLETYPE_FLOAT;
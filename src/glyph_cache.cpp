@@ -0,0 +1,895 @@
+#include "glyph_cache.hpp"
+#include "mapped_file.hpp"
+#include "SDL_stdinc.h"
+#include "SDL_rwops.h"
+#include <cassert>
+#include <cstring>
+
+#include "logging.h"
+
+uint32_t DecodeUTF8(const char*& text)
+{
+    constexpr uint32_t Replacement = 0xFFFD;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(text);
+
+    int length;
+    uint32_t codepoint;
+    if (bytes[0] < 0x80)
+    {
+        text += 1;
+        return bytes[0];
+    }
+    else if ((bytes[0] & 0xE0) == 0xC0)
+    {
+        length = 2;
+        codepoint = bytes[0] & 0x1F;
+    }
+    else if ((bytes[0] & 0xF0) == 0xE0)
+    {
+        length = 3;
+        codepoint = bytes[0] & 0x0F;
+    }
+    else if ((bytes[0] & 0xF8) == 0xF0)
+    {
+        length = 4;
+        codepoint = bytes[0] & 0x07;
+    }
+    else
+    {
+        text += 1;
+        return Replacement;
+    }
+
+    for (int i = 1; i < length; i++)
+    {
+        // Also stops at the terminator, so truncated sequences never read past the string
+        if ((bytes[i] & 0xC0) != 0x80)
+        {
+            text += i;
+            return Replacement;
+        }
+        codepoint = (codepoint << 6) | (bytes[i] & 0x3F);
+    }
+    text += length;
+
+    // Reject overlong encodings, surrogates and values past the unicode range
+    constexpr uint32_t minimum[] = {0, 0, 0x80, 0x800, 0x10000};
+    if (codepoint < minimum[length] || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+    {
+        return Replacement;
+    }
+    return codepoint;
+}
+
+static int RoundUpToPowerOfTwo(int value)
+{
+    int result = 1;
+    while (result < value)
+    {
+        result *= 2;
+    }
+    return result;
+}
+
+void GlyphCache::Initialize()
+{
+    GrowAtlas(PageSize, PageSize);
+}
+
+// Glyph rectangles are atlas pixels and keep their place, only the texture coordinates
+// derived from them change. Layouts submitted earlier in the same frame draw garbled once
+void GlyphCache::GrowAtlas(int width, int height)
+{
+    width = SDL_max(width, atlasWidth);
+    height = SDL_max(height, atlasHeight);
+    assert(width <= AtlasSize && height <= AtlasSize);
+    if (width == atlasWidth && height == atlasHeight)
+    {
+        return;
+    }
+
+    uint8_t* grown = static_cast<uint8_t*>(SDL_calloc(static_cast<size_t>(width) * height, 1));
+    assert(grown != nullptr);
+    for (int row = 0; row < atlasHeight; row++)
+    {
+        memcpy(grown + row * width, pixels + row * atlasWidth, atlasWidth);
+    }
+    SDL_free(pixels);
+    pixels = grown;
+
+    if (image.id != SG_INVALID_ID)
+    {
+        sg_destroy_image(image);
+    }
+    sg_image_desc image_desc = {
+        .width = width,
+        .height = height,
+        .usage = SG_USAGE_DYNAMIC,
+        .pixel_format = SG_PIXELFORMAT_R8,
+        .label = "glyph-atlas",
+    };
+    image = sg_make_image(image_desc);
+    assert(image.id != SG_INVALID_ID);
+
+    atlasWidth = width;
+    atlasHeight = height;
+    dirty = true;
+    generation++;
+
+    char message[64];
+    SDL_snprintf(message, sizeof(message), "Glyph atlas grown to %dx%d", width, height);
+    LOG(LOG_INFO, message);
+}
+
+bool GlyphCache::IsPageInAtlas(uint16_t page) const
+{
+    return (page % PagesPerRow) * PageSize < atlasWidth && (page / PagesPerRow) * PageSize < atlasHeight;
+}
+
+void GlyphCache::Shutdown()
+{
+    for (LoadedFont& font : fonts)
+    {
+        SDL_free(font.data);
+    }
+    fonts.clear();
+
+    entries.clear();
+    freeEntries.clear();
+    lookup.clear();
+    for (Page& page : pages)
+    {
+        page = Page{};
+    }
+
+    sg_destroy_image(image);
+    image = {};
+    SDL_free(pixels);
+    pixels = nullptr;
+    atlasWidth = 0;
+    atlasHeight = 0;
+}
+
+FontId GlyphCache::AddFont(void* ttfData, FontMode mode /* = FontMode::Coverage */)
+{
+    if (fonts.size() >= InvalidFont)
+    {
+        LOG(LOG_ERROR, "Too many fonts loaded");
+        SDL_free(ttfData);
+        return InvalidFont;
+    }
+
+    LoadedFont font = {.data = ttfData, .mode = mode};
+    const unsigned char* data = static_cast<const unsigned char*>(ttfData);
+    if (!stbtt_InitFont(&font.info, data, stbtt_GetFontOffsetForIndex(data, 0)))
+    {
+        LOG(LOG_ERROR, "Could not parse font file");
+        SDL_free(ttfData);
+        return InvalidFont;
+    }
+
+    fonts.push_back(font);
+    return static_cast<FontId>(fonts.size() - 1);
+}
+
+FontId GlyphCache::LoadFont(const char* path, FontMode mode /* = FontMode::Coverage */)
+{
+    void* fontFile = SDL_LoadFile(path, NULL);
+    if (fontFile == NULL)
+    {
+        LOG(LOG_ERROR, "Could not open font file");
+        SDL_ClearError();
+        return InvalidFont;
+    }
+
+    FontId id = AddFont(fontFile, mode);
+    if (id != InvalidFont)
+    {
+        fonts[id].path = path;
+    }
+    return id;
+}
+
+FontId GlyphCache::FindFont(const char* path, FontMode mode) const
+{
+    for (size_t i = 0; i < fonts.size(); i++)
+    {
+        if (fonts[i].mode == mode && fonts[i].path == path)
+        {
+            return static_cast<FontId>(i);
+        }
+    }
+    return InvalidFont;
+}
+
+bool GlyphCache::ReloadFont(FontId font, const char* path, FontMode mode /* = FontMode::Coverage */)
+{
+    assert(font < fonts.size());
+
+    void* fontFile = SDL_LoadFile(path, NULL);
+    if (fontFile == NULL)
+    {
+        LOG(LOG_ERROR, "Could not open font file");
+        SDL_ClearError();
+        return false;
+    }
+
+    stbtt_fontinfo info;
+    const unsigned char* data = static_cast<const unsigned char*>(fontFile);
+    if (!stbtt_InitFont(&info, data, stbtt_GetFontOffsetForIndex(data, 0)))
+    {
+        LOG(LOG_ERROR, "Could not parse font file");
+        SDL_free(fontFile);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < entries.size(); i++)
+    {
+        if (entries[i].live && (entries[i].key >> 56) == font)
+        {
+            Evict(i);
+        }
+    }
+    for (Page& page : pages)
+    {
+        if (page.sizeClass == PinnedPage && page.pinnedFont == font)
+        {
+            page = Page{};
+        }
+    }
+
+    SDL_free(fonts[font].data);
+    fonts[font] = {.path = path, .data = fontFile, .info = info, .mode = mode};
+    generation++;
+    return true;
+}
+
+FontId GlyphCache::LoadBakedFont(const char* bakedPath, const char* ttfPath, FontMode mode /* = FontMode::Coverage */)
+{
+    MappedFile file;
+    if (!file.Open(bakedPath))
+    {
+        LOG(LOG_INFO, "No baked font found, rasterizing from the ttf");
+        return LoadFont(ttfPath, mode);
+    }
+
+    if (file.GetSize() < sizeof(BakedFontHeader))
+    {
+        LOG(LOG_WARNING, "Baked font is truncated, rasterizing from the ttf");
+        return LoadFont(ttfPath, mode);
+    }
+
+    BakedFontHeader header;
+    memcpy(&header, file.GetData(), sizeof(header));
+    size_t glyphBytes = sizeof(BakedGlyph) * header.glyphCount;
+    size_t pixelBytes = static_cast<size_t>(header.width) * header.height;
+
+    bool valid = header.magic == BakedFontMagic && header.version == BakedFontVersion && header.mode == mode &&
+                 header.width == AtlasSize && header.height > 0 && header.height <= AtlasSize && header.height % PageSize == 0 &&
+                 file.GetSize() == sizeof(header) + glyphBytes + pixelBytes;
+    if (valid && mode == FontMode::DistanceField)
+    {
+        valid = header.pixelHeight == SdfPixelHeight && header.sdfPadding == SdfPadding && header.sdfOnEdge == SdfOnEdge;
+    }
+    if (!valid)
+    {
+        LOG(LOG_WARNING, "Baked font doesn't match this build, rasterizing from the ttf");
+        return LoadFont(ttfPath, mode);
+    }
+
+    // Sizing the ttf doesn't read it, so a stale bake is caught without giving up the fast path
+    SDL_RWops* ttf = SDL_RWFromFile(ttfPath, "rb");
+    if (ttf != nullptr)
+    {
+        Sint64 ttfSize = SDL_RWsize(ttf);
+        SDL_RWclose(ttf);
+        if (ttfSize != header.sourceSize)
+        {
+            LOG(LOG_WARNING, "Baked font is older than its ttf, rasterizing from the ttf");
+            return LoadFont(ttfPath, mode);
+        }
+    }
+    else
+    {
+        SDL_ClearError();
+    }
+
+    if (fonts.size() >= InvalidFont)
+    {
+        LOG(LOG_ERROR, "Too many fonts loaded");
+        return InvalidFont;
+    }
+    FontId font = static_cast<FontId>(fonts.size());
+    fonts.push_back({.path = ttfPath, .data = nullptr, .mode = mode});
+
+    // The bake covers whole rows of pages from the top of the atlas
+    if (!PinRegion(font, 0, 0, PagesPerRow, header.height / PageSize))
+    {
+        LOG(LOG_ERROR, "Atlas space for the baked font is taken by another bake");
+        fonts.pop_back();
+        return LoadFont(ttfPath, mode);
+    }
+
+    // The bake's rows are exactly atlas rows once the atlas is as wide, so the pixels go over in one copy
+    GrowAtlas(AtlasSize, RoundUpToPowerOfTwo(header.height));
+    const uint8_t* bakedPixels = file.GetData() + sizeof(header) + glyphBytes;
+    memcpy(pixels, bakedPixels, pixelBytes);
+    dirty = true;
+
+    int pixelHeight = mode == FontMode::DistanceField ? SdfPixelHeight : header.pixelHeight;
+    const uint8_t* glyphData = file.GetData() + sizeof(header);
+    for (uint32_t i = 0; i < header.glyphCount; i++)
+    {
+        BakedGlyph baked;
+        memcpy(&baked, glyphData + i * sizeof(BakedGlyph), sizeof(baked));
+
+        uint64_t key = MakeKey(font, pixelHeight, baked.codepoint);
+        lookup[key] = AddEntry({
+            .key = key,
+            .glyph = {
+                baked.x0, baked.y0, baked.x1, baked.y1, baked.xoff, baked.yoff, baked.xadvance,
+                baked.xoff + (baked.x1 - baked.x0), baked.yoff + (baked.y1 - baked.y0),
+            },
+            .lastUsedFrame = frame,
+            .page = NoPage,
+            .live = true,
+        });
+    }
+
+    generation++;
+    return font;
+}
+
+bool GlyphCache::PackFont(FontId font, int pixelHeight, const CodepointRange* ranges, int rangeCount)
+{
+    assert(font < fonts.size() && "Unknown font");
+    if (fonts[font].mode != FontMode::Coverage)
+    {
+        LOG(LOG_WARNING, "stbtt_Pack only produces coverage glyphs, distance field fonts are not packed");
+        return false;
+    }
+    if (!EnsureFontData(font))
+    {
+        return false;
+    }
+
+    int glyphCount = 0;
+    for (int i = 0; i < rangeCount; i++)
+    {
+        glyphCount += ranges[i].count;
+    }
+
+    std::vector<stbtt_packedchar> packed(glyphCount);
+    std::vector<stbtt_pack_range> packRanges(rangeCount);
+    for (int i = 0, first = 0; i < rangeCount; i++)
+    {
+        packRanges[i] = {
+            .font_size = static_cast<float>(pixelHeight),
+            .first_unicode_codepoint_in_range = static_cast<int>(ranges[i].first),
+            .num_chars = ranges[i].count,
+            .chardata_for_range = packed.data() + first,
+        };
+        first += ranges[i].count;
+    }
+
+    // Grow the region through 128x128, 256x128, 256x256, ... until everything fits
+    int width = PageSize, height = PageSize;
+    unsigned char* scratch = nullptr;
+    while (true)
+    {
+        scratch = static_cast<unsigned char*>(SDL_calloc(static_cast<size_t>(width) * height, 1));
+        assert(scratch != nullptr);
+
+        stbtt_pack_context context;
+        bool packedAll = false;
+        if (stbtt_PackBegin(&context, scratch, width, height, 0, 1, nullptr))
+        {
+            stbtt_PackSetOversampling(&context, PackOversampleX, PackOversampleY);
+            packedAll = stbtt_PackFontRanges(&context, static_cast<const unsigned char*>(fonts[font].data), 0, packRanges.data(), rangeCount) != 0;
+            stbtt_PackEnd(&context);
+        }
+        if (packedAll)
+        {
+            break;
+        }
+
+        SDL_free(scratch);
+        scratch = nullptr;
+        if (width == AtlasSize && height == AtlasSize)
+        {
+            LOG(LOG_ERROR, "Packed font ranges don't fit into the glyph atlas");
+            return false;
+        }
+        if (height < width)
+        {
+            height *= 2;
+        }
+        else
+        {
+            width *= 2;
+        }
+    }
+
+    // First page aligned spot that isn't pinned or in use this frame
+    int columns = width / PageSize;
+    int rows = height / PageSize;
+    bool pinned = false;
+    int originX = 0, originY = 0;
+    for (int pageY = 0; pageY + rows <= PagesPerRow && !pinned; pageY += rows)
+    {
+        for (int pageX = 0; pageX + columns <= PagesPerRow && !pinned; pageX += columns)
+        {
+            if (PinRegion(font, pageX, pageY, columns, rows))
+            {
+                pinned = true;
+                originX = pageX * PageSize;
+                originY = pageY * PageSize;
+            }
+        }
+    }
+    if (!pinned)
+    {
+        LOG(LOG_ERROR, "No free atlas region for the packed font");
+        SDL_free(scratch);
+        return false;
+    }
+
+    GrowAtlas(RoundUpToPowerOfTwo(originX + width), RoundUpToPowerOfTwo(originY + height));
+    for (int row = 0; row < height; row++)
+    {
+        memcpy(pixels + (originY + row) * atlasWidth + originX, scratch + row * width, width);
+    }
+    SDL_free(scratch);
+    dirty = true;
+
+    size_t usedPixels = 0;
+    for (int i = 0, first = 0; i < rangeCount; i++)
+    {
+        for (int c = 0; c < ranges[i].count; c++)
+        {
+            const stbtt_packedchar& glyph = packed[first + c];
+            usedPixels += static_cast<size_t>(glyph.x1 - glyph.x0) * (glyph.y1 - glyph.y0);
+
+            uint64_t key = MakeKey(font, pixelHeight, ranges[i].first + c);
+            auto found = lookup.find(key);
+            if (found != lookup.end())
+            {
+                Evict(found->second);
+            }
+            lookup[key] = AddEntry({
+                .key = key,
+                .glyph = {
+                    static_cast<uint16_t>(originX + glyph.x0), static_cast<uint16_t>(originY + glyph.y0),
+                    static_cast<uint16_t>(originX + glyph.x1), static_cast<uint16_t>(originY + glyph.y1),
+                    glyph.xoff, glyph.yoff, glyph.xadvance, glyph.xoff2, glyph.yoff2,
+                },
+                .lastUsedFrame = frame,
+                .page = NoPage,
+                .live = true,
+            });
+        }
+        first += ranges[i].count;
+    }
+
+    char message[128];
+    SDL_snprintf(message, sizeof(message), "Packed %d glyphs into %dx%d, %.1f%% of the region used",
+        glyphCount, width, height, 100.0 * usedPixels / (static_cast<double>(width) * height));
+    LOG(LOG_INFO, message);
+
+    generation++;
+    return true;
+}
+
+bool GlyphCache::HasPinnedGlyphs(FontId font) const
+{
+    for (const Page& page : pages)
+    {
+        if (page.sizeClass == PinnedPage && page.pinnedFont == font)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GlyphCache::PinRegion(FontId font, int pageX, int pageY, int pageColumns, int pageRows)
+{
+    for (int y = pageY; y < pageY + pageRows; y++)
+    {
+        for (int x = pageX; x < pageX + pageColumns; x++)
+        {
+            const Page& page = pages[y * PagesPerRow + x];
+            if (page.sizeClass == PinnedPage || (page.sizeClass != FreePage && page.lastUsedFrame == frame))
+            {
+                return false;
+            }
+        }
+    }
+
+    for (int y = pageY; y < pageY + pageRows; y++)
+    {
+        for (int x = pageX; x < pageX + pageColumns; x++)
+        {
+            Page& page = pages[y * PagesPerRow + x];
+            for (uint32_t index : page.cells)
+            {
+                if (index != NoGlyph)
+                {
+                    Evict(index);
+                }
+            }
+            page = Page{.sizeClass = PinnedPage, .pinnedFont = font};
+        }
+    }
+    return true;
+}
+
+bool GlyphCache::EnsureFontData(FontId font)
+{
+    LoadedFont& loaded = fonts[font];
+    if (loaded.data != nullptr)
+    {
+        return true;
+    }
+    if (loaded.loadFailed)
+    {
+        return false;
+    }
+
+    void* fontFile = SDL_LoadFile(loaded.path.c_str(), NULL);
+    const unsigned char* data = static_cast<const unsigned char*>(fontFile);
+    if (fontFile == NULL || !stbtt_InitFont(&loaded.info, data, stbtt_GetFontOffsetForIndex(data, 0)))
+    {
+        // Only glyphs outside the bake are affected, so this is logged once and not retried
+        LOG(LOG_ERROR, "Could not load the ttf behind a baked font");
+        SDL_ClearError();
+        SDL_free(fontFile);
+        loaded.loadFailed = true;
+        return false;
+    }
+
+    loaded.data = fontFile;
+    return true;
+}
+
+uint32_t GlyphCache::AddEntry(const Entry& entry)
+{
+    uint32_t index;
+    if (!freeEntries.empty())
+    {
+        index = freeEntries.back();
+        freeEntries.pop_back();
+        entries[index] = entry;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(entries.size());
+        entries.push_back(entry);
+    }
+    return index;
+}
+
+uint64_t GlyphCache::MakeKey(FontId font, int pixelHeight, uint32_t codepoint)
+{
+    return (static_cast<uint64_t>(font) << 56) | (static_cast<uint64_t>(pixelHeight & 0xFFFF) << 32) | codepoint;
+}
+
+bool GlyphCache::GetGlyph(FontId font, int pixelHeight, uint32_t codepoint, Glyph& glyph, uint32_t* handle /* = nullptr */)
+{
+    assert(font < fonts.size() && "Unknown font");
+    assert(pixelHeight > 0 && pixelHeight <= UINT16_MAX);
+
+    // One set of distance field glyphs serves every size
+    if (fonts[font].mode == FontMode::DistanceField)
+    {
+        pixelHeight = SdfPixelHeight;
+    }
+
+    uint64_t key = MakeKey(font, pixelHeight, codepoint);
+    uint32_t index;
+    auto found = lookup.find(key);
+    if (found != lookup.end())
+    {
+        index = found->second;
+    }
+    else if (!Rasterize(key, font, pixelHeight, codepoint, &index))
+    {
+        return false;
+    }
+
+    Touch(index);
+    glyph = entries[index].glyph;
+    if (handle != nullptr)
+    {
+        *handle = index;
+    }
+    return true;
+}
+
+void GlyphCache::Touch(uint32_t handle)
+{
+    Entry& entry = entries[handle];
+    assert(entry.live && "Stale glyph handle");
+    entry.lastUsedFrame = frame;
+    if (entry.page != NoPage)
+    {
+        pages[entry.page].lastUsedFrame = frame;
+    }
+}
+
+bool GlyphCache::Rasterize(uint64_t key, FontId font, int pixelHeight, uint32_t codepoint, uint32_t* entryIndex)
+{
+    if (!EnsureFontData(font))
+    {
+        return false;
+    }
+
+    const stbtt_fontinfo& info = fonts[font].info;
+    float scale = stbtt_ScaleForPixelHeight(&info, static_cast<float>(pixelHeight));
+    // Index 0 is the font's notdef glyph, so unsupported codepoints still draw something
+    int glyphIndex = stbtt_FindGlyphIndex(&info, static_cast<int>(codepoint));
+
+    int advance, leftSideBearing;
+    stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &leftSideBearing);
+
+    int ix0, iy0, width, height;
+    unsigned char* sdf = nullptr;
+    if (fonts[font].mode == FontMode::DistanceField)
+    {
+        // The field extends SdfPadding pixels past the outline, the offsets already include it
+        constexpr float distanceScale = static_cast<float>(SdfOnEdge) / SdfPadding;
+        sdf = stbtt_GetGlyphSDF(&info, scale, glyphIndex, SdfPadding, SdfOnEdge, distanceScale, &width, &height, &ix0, &iy0);
+        if (sdf == nullptr)
+        {
+            width = height = ix0 = iy0 = 0;
+        }
+    }
+    else
+    {
+        int ix1, iy1;
+        stbtt_GetGlyphBitmapBox(&info, glyphIndex, scale, scale, &ix0, &iy0, &ix1, &iy1);
+        width = ix1 - ix0;
+        height = iy1 - iy0;
+    }
+
+    Entry entry = {
+        .key = key,
+        .glyph = {
+            .xoff = static_cast<float>(ix0),
+            .yoff = static_cast<float>(iy0),
+            .xadvance = scale * advance,
+            .xoff2 = static_cast<float>(ix0 + width),
+            .yoff2 = static_cast<float>(iy0 + height),
+        },
+        .lastUsedFrame = frame,
+        .page = NoPage,
+        .live = true,
+    };
+
+    if (width > 0 && height > 0)
+    {
+        int sizeClass = -1;
+        for (int i = 0; i < SizeClassCount; i++)
+        {
+            if (SDL_max(width, height) + 1 <= SizeClasses[i])
+            {
+                sizeClass = i;
+                break;
+            }
+        }
+
+        if (sizeClass < 0)
+        {
+            LOG(LOG_WARNING, "Glyph is larger than an atlas page, drawing it as blank");
+        }
+        else
+        {
+            if (!AllocateCell(sizeClass, &entry.page, &entry.cell))
+            {
+                LOG(LOG_WARNING, "Glyph atlas is full of glyphs used this frame");
+                stbtt_FreeSDF(sdf, nullptr);
+                return false;
+            }
+
+            int cellSize = SizeClasses[sizeClass];
+            int cellsPerRow = PageSize / cellSize;
+            int x = (entry.page % PagesPerRow) * PageSize + (entry.cell % cellsPerRow) * cellSize;
+            int y = (entry.page / PagesPerRow) * PageSize + (entry.cell / cellsPerRow) * cellSize;
+
+            ClearCell(entry.page, entry.cell);
+            if (sdf != nullptr)
+            {
+                for (int row = 0; row < height; row++)
+                {
+                    memcpy(pixels + (y + row) * atlasWidth + x, sdf + row * width, width);
+                }
+            }
+            else
+            {
+                stbtt_MakeGlyphBitmap(&info, pixels + y * atlasWidth + x, width, height, atlasWidth, scale, scale, glyphIndex);
+            }
+            dirty = true;
+
+            entry.glyph.x0 = static_cast<uint16_t>(x);
+            entry.glyph.y0 = static_cast<uint16_t>(y);
+            entry.glyph.x1 = static_cast<uint16_t>(x + width);
+            entry.glyph.y1 = static_cast<uint16_t>(y + height);
+        }
+    }
+    stbtt_FreeSDF(sdf, nullptr);
+
+    uint32_t index = AddEntry(entry);
+
+    if (entry.page != NoPage)
+    {
+        Page& page = pages[entry.page];
+        page.cells[entry.cell] = index;
+        page.freeCells--;
+    }
+    lookup[key] = index;
+    *entryIndex = index;
+    return true;
+}
+
+bool GlyphCache::AllocateCell(int sizeClass, uint16_t* page, uint16_t* cell)
+{
+    // Prefer a free cell in a page of the same size class
+    for (uint16_t p = 0; p < PageCount; p++)
+    {
+        if (pages[p].sizeClass != sizeClass || pages[p].freeCells == 0)
+        {
+            continue;
+        }
+        for (uint16_t c = 0; c < pages[p].cells.size(); c++)
+        {
+            if (pages[p].cells[c] == NoGlyph)
+            {
+                *page = p;
+                *cell = c;
+                return true;
+            }
+        }
+    }
+
+    // Then an unassigned page
+    if (ClaimPage(sizeClass, page))
+    {
+        *cell = 0;
+        return true;
+    }
+
+    // Then the least recently used glyph of the size class
+    uint32_t oldest = NoGlyph;
+    for (const Page& p : pages)
+    {
+        if (p.sizeClass != sizeClass)
+        {
+            continue;
+        }
+        for (uint32_t index : p.cells)
+        {
+            if (index != NoGlyph && entries[index].lastUsedFrame != frame &&
+                (oldest == NoGlyph || entries[index].lastUsedFrame < entries[oldest].lastUsedFrame))
+            {
+                oldest = index;
+            }
+        }
+    }
+    if (oldest != NoGlyph)
+    {
+        *page = entries[oldest].page;
+        *cell = entries[oldest].cell;
+        Evict(oldest);
+        return true;
+    }
+
+    // Last resort, take over the least recently used page of another size class
+    uint16_t oldestPage = NoPage;
+    for (uint16_t p = 0; p < PageCount; p++)
+    {
+        if (pages[p].sizeClass >= 0 && pages[p].sizeClass != sizeClass && pages[p].lastUsedFrame != frame &&
+            (oldestPage == NoPage || pages[p].lastUsedFrame < pages[oldestPage].lastUsedFrame))
+        {
+            oldestPage = p;
+        }
+    }
+    if (oldestPage == NoPage)
+    {
+        return false;
+    }
+
+    for (uint32_t index : pages[oldestPage].cells)
+    {
+        if (index != NoGlyph)
+        {
+            Evict(index);
+        }
+    }
+    pages[oldestPage].sizeClass = FreePage;
+
+    bool claimed = ClaimPage(sizeClass, page);
+    assert(claimed);
+    *cell = 0;
+    return claimed;
+}
+
+bool GlyphCache::ClaimPage(int sizeClass, uint16_t* page)
+{
+    while (true)
+    {
+        for (uint16_t p = 0; p < PageCount; p++)
+        {
+            if (pages[p].sizeClass == FreePage && IsPageInAtlas(p))
+            {
+                int cellsPerRow = PageSize / SizeClasses[sizeClass];
+                pages[p].sizeClass = sizeClass;
+                pages[p].cells.assign(cellsPerRow * cellsPerRow, NoGlyph);
+                pages[p].freeCells = cellsPerRow * cellsPerRow;
+                *page = p;
+                return true;
+            }
+        }
+
+        // Out of pages, grow through 128x128, 256x128, 256x256, ... before anything gets evicted
+        if (atlasWidth == AtlasSize && atlasHeight == AtlasSize)
+        {
+            return false;
+        }
+        if (atlasHeight < atlasWidth)
+        {
+            GrowAtlas(atlasWidth, atlasHeight * 2);
+        }
+        else
+        {
+            GrowAtlas(atlasWidth * 2, atlasHeight);
+        }
+    }
+}
+
+void GlyphCache::Evict(uint32_t entryIndex)
+{
+    Entry& entry = entries[entryIndex];
+    assert(entry.live);
+
+    if (entry.page != NoPage)
+    {
+        Page& page = pages[entry.page];
+        page.cells[entry.cell] = NoGlyph;
+        page.freeCells++;
+    }
+
+    lookup.erase(entry.key);
+    entry.live = false;
+    freeEntries.push_back(entryIndex);
+
+    generation++;
+    evictions++;
+}
+
+void GlyphCache::ClearCell(uint16_t page, uint16_t cell)
+{
+    int cellSize = SizeClasses[pages[page].sizeClass];
+    int cellsPerRow = PageSize / cellSize;
+    int x = (page % PagesPerRow) * PageSize + (cell % cellsPerRow) * cellSize;
+    int y = (page / PagesPerRow) * PageSize + (cell / cellsPerRow) * cellSize;
+
+    for (int row = 0; row < cellSize; row++)
+    {
+        memset(pixels + (y + row) * atlasWidth + x, 0, cellSize);
+    }
+}
+
+void GlyphCache::Flush()
+{
+    // sokol can only replace a dynamic image as a whole and only once per frame,
+    // so every glyph rasterized this frame rides along in the same upload
+    if (dirty)
+    {
+        sg_image_data data = {};
+        data.subimage[0][0] = { .ptr = pixels, .size = static_cast<size_t>(atlasWidth) * atlasHeight };
+        sg_update_image(image, data);
+        dirty = false;
+    }
+
+    frame++;
+}
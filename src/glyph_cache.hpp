@@ -0,0 +1,166 @@
+#pragma once
+#ifndef GLYPH_CACHE_HPP
+#define GLYPH_CACHE_HPP
+
+#include "sokol_gfx.h"
+#include "stb_truetype.h"
+#include "baked_font.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+typedef uint8_t FontId;
+constexpr FontId InvalidFont = UINT8_MAX;
+
+// Placement of a cached glyph, same layout and meaning as stbtt_packedchar.
+// x0..y1 are atlas pixels, the quad spans xoff,yoff to xoff2,yoff2 relative to the pen position
+// on the baseline. Oversampled glyphs cover more atlas pixels than their quad is wide
+struct Glyph{
+    uint16_t x0, y0, x1, y1;
+    float xoff, yoff, xadvance;
+    float xoff2, yoff2;
+};
+
+struct CodepointRange{
+    uint32_t first;
+    int count;
+};
+
+struct Font{
+    FontId id;
+    int pixelHeight;
+};
+
+// Decodes one UTF-8 sequence and advances text past it, malformed input yields U+FFFD
+uint32_t DecodeUTF8(const char*& text);
+
+// Rasterizes glyphs on demand into a single shared atlas texture. The atlas is cut into pages,
+// every page holds square cells of one size class so glyphs of similar size pack together.
+// The atlas starts at a single page and doubles whenever no free page is left, up to AtlasSize.
+// Only then does a size class that runs out of cells evict its least recently used glyph, glyphs
+// used during the current frame are never evicted. Rasterized glyphs go into a CPU copy of the
+// atlas and all changes of a frame reach the GPU with a single update in Flush.
+class GlyphCache
+{
+public:
+    // Largest edge length the atlas grows to
+    static constexpr int AtlasSize = 1024;
+    static constexpr int PageSize = 128;
+    static constexpr int PagesPerRow = AtlasSize / PageSize;
+    static constexpr int PageCount = PagesPerRow * PagesPerRow;
+    // Cell edge lengths, a glyph takes the smallest cell that fits it plus one pixel of padding
+    static constexpr int SizeClasses[] = {16, 32, 64, 128};
+    static constexpr int SizeClassCount = sizeof(SizeClasses) / sizeof(SizeClasses[0]);
+    // Horizontal oversampling of packed glyphs, sharper edges at fractional positions for twice the width
+    static constexpr int PackOversampleX = 2;
+    static constexpr int PackOversampleY = 1;
+
+private:
+    static constexpr uint16_t NoPage = UINT16_MAX;
+    static constexpr uint32_t NoGlyph = UINT32_MAX;
+
+    struct LoadedFont{
+        // Fonts seeded from a bake only read their ttf once a glyph outside the bake is needed
+        std::string path;
+        void* data;
+        stbtt_fontinfo info;
+        FontMode mode;
+        bool loadFailed;
+    };
+
+    // Page::sizeClass values besides the size class indices
+    static constexpr int FreePage = -1;
+    static constexpr int PinnedPage = -2;
+
+    struct Page{
+        int sizeClass = FreePage;
+        // Pinned pages hold a baked region and are never evicted
+        FontId pinnedFont = InvalidFont;
+        // Entry occupying each cell, NoGlyph when the cell is free
+        std::vector<uint32_t> cells;
+        int freeCells = 0;
+        uint32_t lastUsedFrame = 0;
+    };
+
+    struct Entry{
+        uint64_t key;
+        Glyph glyph;
+        uint32_t lastUsedFrame;
+        // NoPage for glyphs without pixels, like spaces
+        uint16_t page;
+        uint16_t cell;
+        bool live;
+    };
+
+    std::vector<LoadedFont> fonts;
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> freeEntries;
+    std::unordered_map<uint64_t, uint32_t> lookup;
+    Page pages[PageCount];
+
+    // CPU copy of the atlas, atlasWidth pixels per row
+    uint8_t* pixels = nullptr;
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+    sg_image image = {};
+    bool dirty = false;
+
+    uint32_t frame = 1;
+    uint32_t generation = 0;
+    uint64_t evictions = 0;
+
+    static uint64_t MakeKey(FontId font, int pixelHeight, uint32_t codepoint);
+    void GrowAtlas(int width, int height);
+    bool IsPageInAtlas(uint16_t page) const;
+    bool AllocateCell(int sizeClass, uint16_t* page, uint16_t* cell);
+    bool ClaimPage(int sizeClass, uint16_t* page);
+    void Evict(uint32_t entryIndex);
+    void ClearCell(uint16_t page, uint16_t cell);
+    bool Rasterize(uint64_t key, FontId font, int pixelHeight, uint32_t codepoint, uint32_t* entryIndex);
+    bool EnsureFontData(FontId font);
+    bool PinRegion(FontId font, int pageX, int pageY, int pageColumns, int pageRows);
+    uint32_t AddEntry(const Entry& entry);
+public:
+    void Initialize();
+    void Shutdown();
+
+    // Takes ownership of the ttf data, returns InvalidFont if stb_truetype can't parse it
+    FontId AddFont(void* ttfData, FontMode mode = FontMode::Coverage);
+    FontId LoadFont(const char* path, FontMode mode = FontMode::Coverage);
+    // Seeds the atlas with glyphs baked by tools/font_baker. The ttf is only read once a glyph
+    // outside the bake is requested. Falls back to LoadFont when the bake is missing or doesn't match
+    FontId LoadBakedFont(const char* bakedPath, const char* ttfPath, FontMode mode = FontMode::Coverage);
+    // Packs coverage glyphs for the ranges with stbtt_PackFontRanges into the smallest power of two
+    // region that fits and pins it, so the common glyphs share tightly packed, oversampled pages
+    bool PackFont(FontId font, int pixelHeight, const CodepointRange* ranges, int rangeCount);
+    bool HasPinnedGlyphs(FontId font) const;
+    // Font previously loaded from path in mode, InvalidFont if there is none
+    FontId FindFont(const char* path, FontMode mode) const;
+    // Swaps the font data behind an id and drops all of its glyphs
+    bool ReloadFont(FontId font, const char* path, FontMode mode = FontMode::Coverage);
+
+    // Looks up a codepoint at a pixel height, rasterizing it if needed. Codepoints missing
+    // from the font use its notdef glyph. Fails only if the atlas is full of glyphs used this frame.
+    // Distance field fonts ignore the height and return metrics for SdfPixelHeight
+    bool GetGlyph(FontId font, int pixelHeight, uint32_t codepoint, Glyph& glyph, uint32_t* handle = nullptr);
+    // Marks a glyph as used this frame without looking it up again. Handles stay valid while the generation is unchanged
+    void Touch(uint32_t handle);
+
+    // Uploads this frame's new glyphs, call once per frame before drawing
+    void Flush();
+
+    FontMode GetMode(FontId font) const { return fonts[font].mode; }
+
+    // The image is replaced when the atlas grows, fetch it again every frame
+    sg_image GetImage() const { return image; }
+    int GetAtlasWidth() const { return atlasWidth; }
+    int GetAtlasHeight() const { return atlasHeight; }
+    // Changes whenever a glyph moves or disappears or the atlas grows, anything caching atlas coordinates compares against it
+    uint32_t GetGeneration() const { return generation; }
+    size_t GetGlyphCount() const { return lookup.size(); }
+    uint64_t GetEvictionCount() const { return evictions; }
+};
+
+#endif // GLYPH_CACHE_HPP
@@ -1,46 +1,244 @@
 #include "input.hpp"
+#include "spsc_queue.hpp"
+#include "SDL_timer.h"
+#include <cassert>
 
 namespace Input
 {
 
     static struct {
-        bool keys[SDL_NUM_SCANCODES] = {0};
-        bool keys_previous[SDL_NUM_SCANCODES] = {0};
+        uint64_t keys[KeyWordCount] = {0};
+        uint64_t keys_previous[KeyWordCount] = {0};
+        // Keys that went down or up at some point during this frame's events
+        uint64_t downs[KeyWordCount] = {0};
+        uint64_t ups[KeyWordCount] = {0};
+        uint64_t pressed[KeyWordCount] = {0};
+        uint64_t released[KeyWordCount] = {0};
+
+        KeyEvent events[MaxFrameKeyEvents];
+        int eventCount = 0;
+        uint32_t frameStart = 0;
+        uint32_t frameEnd = 0;
+
+        // All controllers merged, one bit per SDL_GameControllerButton
+        uint32_t buttons = 0;
+        uint32_t buttons_previous = 0;
+        uint32_t buttonDowns = 0;
+
+        bool enabled = true;
+        bool watching = false;
+
+        EventHook hook = nullptr;
+        void* hookUserData = nullptr;
     } state;
 
+    struct QueuedEvent{
+        uint64_t captureTicks;
+        uint32_t timestamp;
+        uint16_t code;
+        bool down;
+    };
+
+    // Keyboard events are produced by SDL_PumpEvents on the main thread, controller events may come
+    // from SDL's joystick thread instead, so each gets its own single producer queue
+    static SpscQueue<QueuedEvent, 1024> keyQueue;
+    static SpscQueue<QueuedEvent, 256> buttonQueue;
+
+    static int EventWatch(void* userData, SDL_Event* event)
+    {
+        // A full queue means the main loop stalled for over a thousand events, those are dropped
+        uint64_t now = SDL_GetPerformanceCounter();
+        switch (event->type)
+        {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            if (!event->key.repeat)
+            {
+                keyQueue.Push({now, event->key.timestamp, static_cast<uint16_t>(event->key.keysym.scancode), event->type == SDL_KEYDOWN});
+            }
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+            buttonQueue.Push({now, event->cbutton.timestamp, event->cbutton.button, event->type == SDL_CONTROLLERBUTTONDOWN});
+            break;
+        default:
+            break;
+        }
+        return 1;
+    }
+
+    static void ApplyKey(SDL_Scancode scancode, bool down, uint32_t timestamp, uint64_t captureTicks)
+    {
+        if (state.hook != nullptr)
+        {
+            SDL_Event event = {.type = static_cast<Uint32>(down ? SDL_KEYDOWN : SDL_KEYUP)};
+            event.key.timestamp = timestamp;
+            event.key.state = down ? SDL_PRESSED : SDL_RELEASED;
+            event.key.keysym.scancode = scancode;
+            state.hook(event, state.hookUserData);
+        }
+
+        if (state.eventCount < MaxFrameKeyEvents)
+        {
+            state.events[state.eventCount++] = {timestamp, scancode, down, captureTicks};
+        }
+
+        uint64_t bit = uint64_t(1) << (scancode % 64);
+        int word = scancode / 64;
+        if (down)
+        {
+            state.keys[word] |= bit;
+            state.downs[word] |= bit;
+        }
+        else
+        {
+            state.keys[word] &= ~bit;
+            state.ups[word] |= bit;
+        }
+    }
+
+    static void ApplyButton(uint16_t button, bool down, uint32_t timestamp)
+    {
+        if (button >= SDL_CONTROLLER_BUTTON_MAX)
+        {
+            return;
+        }
+        if (state.hook != nullptr)
+        {
+            SDL_Event event = {.type = static_cast<Uint32>(down ? SDL_CONTROLLERBUTTONDOWN : SDL_CONTROLLERBUTTONUP)};
+            event.cbutton.timestamp = timestamp;
+            event.cbutton.button = static_cast<Uint8>(button);
+            event.cbutton.state = down ? SDL_PRESSED : SDL_RELEASED;
+            state.hook(event, state.hookUserData);
+        }
+
+        uint32_t bit = 1u << button;
+        if (down)
+        {
+            state.buttons |= bit;
+            state.buttonDowns |= bit;
+        }
+        else
+        {
+            state.buttons &= ~bit;
+        }
+    }
+
+    void Initialize()
+    {
+        SDL_AddEventWatch(EventWatch, nullptr);
+        state.watching = true;
+    }
+
+    void Shutdown()
+    {
+        SDL_DelEventWatch(EventWatch, nullptr);
+        state.watching = false;
+    }
+
+    void SetEventHook(EventHook hook, void* userData)
+    {
+        state.hook = hook;
+        state.hookUserData = userData;
+    }
+
+    void SetEnabled(bool enabled)
+    {
+        state.enabled = enabled;
+    }
+
+    static inline bool TestBit(const uint64_t* words, SDL_Scancode scancode)
+    {
+        return (words[scancode / 64] >> (scancode % 64)) & 1;
+    }
+
     void UpdateFrame()
     {
-        for (size_t i = 0; i < SDL_NUM_SCANCODES; i++)
+        for (int i = 0; i < KeyWordCount; i++)
         {
             state.keys_previous[i] = state.keys[i];
+            state.downs[i] = 0;
+            state.ups[i] = 0;
         }
+        state.eventCount = 0;
+
+        state.buttons_previous = state.buttons;
+        state.buttonDowns = 0;
     }
 
     void HandleEvent(SDL_Event event)
     {
-        if (event.type == SDL_KEYDOWN)
+        // The watch already queued these
+        if (state.watching)
         {
-            state.keys[event.key.keysym.scancode] = true;
+            return;
         }
-        else if (event.type == SDL_KEYUP)
+
+        if ((event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) && !event.key.repeat)
         {
-            state.keys[event.key.keysym.scancode] = false;
+            // When the event was really captured is unknown here, keep it out of latency tracing
+            ApplyKey(event.key.keysym.scancode, event.type == SDL_KEYDOWN, event.key.timestamp, UnknownCaptureTicks);
+        }
+        else if (event.type == SDL_CONTROLLERBUTTONDOWN || event.type == SDL_CONTROLLERBUTTONUP)
+        {
+            ApplyButton(event.cbutton.button, event.type == SDL_CONTROLLERBUTTONDOWN, event.cbutton.timestamp);
+        }
+    }
+
+    void FinishEvents()
+    {
+        FinishEvents(SDL_GetTicks());
+    }
+
+    void FinishEvents(uint32_t ticks)
+    {
+        // Presses that happened while disabled are dropped, releases always apply
+        QueuedEvent queued;
+        while (keyQueue.Pop(queued))
+        {
+            if (queued.down && !state.enabled)
+            {
+                continue;
+            }
+            ApplyKey(static_cast<SDL_Scancode>(queued.code), queued.down, queued.timestamp, queued.captureTicks);
+        }
+        while (buttonQueue.Pop(queued))
+        {
+            if (queued.down && !state.enabled)
+            {
+                continue;
+            }
+            ApplyButton(queued.code, queued.down, queued.timestamp);
+        }
+
+        // Taps shorter than a frame leave keys unchanged but still show up in downs and ups
+        for (int i = 0; i < KeyWordCount; i++)
+        {
+            state.pressed[i] = (~state.keys_previous[i] & state.keys[i]) | state.downs[i];
+            state.released[i] = (state.keys_previous[i] & ~state.keys[i]) | state.ups[i];
+        }
+
+        state.frameStart = state.frameEnd;
+        state.frameEnd = ticks;
+        if (state.frameStart == 0)
+        {
+            state.frameStart = state.frameEnd;
         }
     }
 
     bool IsKeyJustPressed(SDL_Scancode scancode)
     {
-        return !state.keys_previous[scancode] && state.keys[scancode];
+        return TestBit(state.pressed, scancode);
     }
 
     bool IsKeyJustReleased(SDL_Scancode scancode)
     {
-        return state.keys_previous[scancode] && !state.keys[scancode];
+        return TestBit(state.released, scancode);
     }
 
     bool IsKeyDown(SDL_Scancode scancode)
     {
-        return state.keys[scancode];
+        return TestBit(state.keys, scancode);
     }
 
     float GetAxis(SDL_Scancode negative, SDL_Scancode positive)
@@ -48,4 +246,119 @@ namespace Input
         return IsKeyDown(negative) * -1.f + IsKeyDown(positive) * 1.f;
     };
 
+    uint32_t GetFrameSpan()
+    {
+        return state.frameEnd - state.frameStart;
+    }
+
+    uint32_t GetFrameEndTicks()
+    {
+        return state.frameEnd;
+    }
+
+    const KeyEvent* GetKeyEvents(int* count)
+    {
+        *count = state.eventCount;
+        return state.events;
+    }
+
+    float GetKeyHeldFraction(SDL_Scancode scancode)
+    {
+        uint32_t span = state.frameEnd - state.frameStart;
+        if (span == 0)
+        {
+            return IsKeyDown(scancode) ? 1.f : 0.f;
+        }
+
+        // Replay the key's changes from its state at the start of the frame
+        bool down = TestBit(state.keys_previous, scancode);
+        uint32_t time = state.frameStart;
+        uint32_t held = 0;
+        for (int i = 0; i < state.eventCount; i++)
+        {
+            const KeyEvent& event = state.events[i];
+            if (event.scancode != scancode)
+            {
+                continue;
+            }
+
+            // Events that slipped in right around the frame boundaries count at the boundary
+            uint32_t timestamp = event.timestamp;
+            timestamp = timestamp < state.frameStart ? state.frameStart : (timestamp > state.frameEnd ? state.frameEnd : timestamp);
+            if (timestamp < time)
+            {
+                timestamp = time;
+            }
+
+            if (down)
+            {
+                held += timestamp - time;
+            }
+            time = timestamp;
+            down = event.down;
+        }
+        if (down)
+        {
+            held += state.frameEnd - time;
+        }
+        return static_cast<float>(held) / span;
+    }
+
+    float GetAxisAverage(SDL_Scancode negative, SDL_Scancode positive)
+    {
+        return GetKeyHeldFraction(positive) - GetKeyHeldFraction(negative);
+    }
+
+    bool IsButtonDown(SDL_GameControllerButton button)
+    {
+        return (state.buttons >> button) & 1;
+    }
+
+    bool IsButtonJustPressed(SDL_GameControllerButton button)
+    {
+        return (((~state.buttons_previous & state.buttons) | state.buttonDowns) >> button) & 1;
+    }
+
+    bool IsAnyKeyJustPressed()
+    {
+        uint64_t any = 0;
+        for (int i = 0; i < KeyWordCount; i++)
+        {
+            any |= state.pressed[i];
+        }
+        return any != 0;
+    }
+
+    bool IsAnyKeyJustPressed(const KeySet& keys)
+    {
+        uint64_t any = 0;
+        for (int i = 0; i < KeyWordCount; i++)
+        {
+            any |= state.pressed[i] & keys.words[i];
+        }
+        return any != 0;
+    }
+
+    bool IsAnyKeyDown(const KeySet& keys)
+    {
+        uint64_t any = 0;
+        for (int i = 0; i < KeyWordCount; i++)
+        {
+            any |= state.keys[i] & keys.words[i];
+        }
+        return any != 0;
+    }
+
+    uint32_t GetActionsJustPressed(const KeySet* actions, int count)
+    {
+        assert(count <= 32);
+
+        uint32_t result = 0;
+        for (int action = 0; action < count; action++)
+        {
+            result |= static_cast<uint32_t>(IsAnyKeyJustPressed(actions[action])) << action;
+        }
+        return result;
+    }
+
 } // namespace Input
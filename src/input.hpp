@@ -3,16 +3,92 @@
 #define INPUT_H
 
 #include "SDL_events.h"
+#include "SDL_gamecontroller.h"
+#include <cstdint>
+#include <initializer_list>
 
 namespace Input
 {
+    constexpr int KeyWordCount = (SDL_NUM_SCANCODES + 63) / 64;
+
+    // One bit per scancode, for querying several keys with a few word operations
+    struct KeySet{
+        uint64_t words[KeyWordCount];
+    };
+
+    // Key change as it arrived from SDL, timestamp in SDL_GetTicks milliseconds.
+    // captureTicks is the SDL_GetPerformanceCounter value when the event watch saw it,
+    // UnknownCaptureTicks for events handed to HandleEvent directly, like replayed ones
+    struct KeyEvent{
+        uint32_t timestamp;
+        SDL_Scancode scancode;
+        bool down;
+        uint64_t captureTicks;
+    };
+
+    constexpr uint64_t UnknownCaptureTicks = UINT64_MAX;
+
+    // Key changes kept per frame, later ones still update the key state but lose their timing
+    constexpr int MaxFrameKeyEvents = 256;
+
+    constexpr KeySet MakeKeySet(std::initializer_list<SDL_Scancode> scancodes)
+    {
+        KeySet set = {};
+        for (SDL_Scancode scancode : scancodes)
+        {
+            set.words[scancode / 64] |= uint64_t(1) << (scancode % 64);
+        }
+        return set;
+    }
+
+    // Installs an SDL event watch that queues key and gamepad button events the moment SDL
+    // pumps them, on whichever thread that happens. FinishEvents drains the queues, so
+    // HandleEvent isn't needed for those events anymore
+    void Initialize();
+    void Shutdown();
+
+    // Sees every key and button event Input applies, after the console filter, for recording
+    typedef void (*EventHook)(const SDL_Event& event, void* userData);
+    void SetEventHook(EventHook hook, void* userData);
+
+    // Call before the event loop
     void UpdateFrame();
+    // Applies an event right away, for callers without the event watch
     void HandleEvent(SDL_Event event);
+    // While disabled queued key and button presses are dropped, releases still go through so nothing sticks.
+    // For when something else, like the console, has the keyboard
+    void SetEnabled(bool enabled);
+    // Computes this frame's pressed and released masks and closes the frame's time span,
+    // which runs from the previous FinishEvents to this one. Call after the event loop
+    void FinishEvents();
+    // Same with the end of the span given in SDL_GetTicks milliseconds, for replays
+    void FinishEvents(uint32_t ticks);
+    uint32_t GetFrameEndTicks();
 
+    // A key pressed and released within one frame counts as both just pressed and just released
     bool IsKeyJustPressed(SDL_Scancode scancode);
     bool IsKeyJustReleased(SDL_Scancode scancode);
     bool IsKeyDown(SDL_Scancode scancode);
     float GetAxis(SDL_Scancode negative, SDL_Scancode positive);
+
+    // This frame's key changes in the order they happened
+    const KeyEvent* GetKeyEvents(int* count);
+    // Part of the frame's time span the key was held, from 0 to 1
+    float GetKeyHeldFraction(SDL_Scancode scancode);
+    // GetAxis averaged over the frame's time span. Scaled by the frame time it moves things exactly
+    // as far as the key was held, no matter where inside the frame it went down or up
+    float GetAxisAverage(SDL_Scancode negative, SDL_Scancode positive);
+    // Length of the frame's time span in SDL_GetTicks milliseconds, what the averages cover
+    uint32_t GetFrameSpan();
+
+    bool IsButtonDown(SDL_GameControllerButton button);
+    bool IsButtonJustPressed(SDL_GameControllerButton button);
+
+    bool IsAnyKeyJustPressed();
+    bool IsAnyKeyJustPressed(const KeySet& keys);
+    bool IsAnyKeyDown(const KeySet& keys);
+    // Bit i of the result is set if any key of actions[i] was just pressed, at most 32 actions
+    uint32_t GetActionsJustPressed(const KeySet* actions, int count);
 }
 
-#endif // INPUT_H
\ No newline at end of file
+#endif // INPUT_H
@@ -0,0 +1,147 @@
+#include "input_recorder.hpp"
+#include "input.hpp"
+#include <cassert>
+
+#include "logging.h"
+
+bool InputRecorder::StartRecording(const char* path, uint32_t seed)
+{
+    Stop();
+
+    file = SDL_RWFromFile(path, "wb");
+    if (file == nullptr)
+    {
+        LOG(LOG_ERROR, "Could not open the input log for writing");
+        SDL_ClearError();
+        return false;
+    }
+
+    InputLogHeader header = {.magic = InputLogMagic, .version = InputLogVersion, .seed = seed};
+    if (SDL_RWwrite(file, &header, sizeof(header), 1) != 1)
+    {
+        LOG(LOG_ERROR, "Could not write the input log");
+        Stop();
+        return false;
+    }
+
+    recording = true;
+    frames = 0;
+    pending.clear();
+    Input::SetEventHook(RecordEvent, this);
+    return true;
+}
+
+bool InputRecorder::StartReplay(const char* path, uint32_t* seed)
+{
+    Stop();
+
+    file = SDL_RWFromFile(path, "rb");
+    if (file == nullptr)
+    {
+        LOG(LOG_ERROR, "Could not open the input log");
+        SDL_ClearError();
+        return false;
+    }
+
+    InputLogHeader header;
+    if (SDL_RWread(file, &header, sizeof(header), 1) != 1 || header.magic != InputLogMagic || header.version != InputLogVersion)
+    {
+        LOG(LOG_ERROR, "Not an input log of this version");
+        Stop();
+        return false;
+    }
+
+    recording = false;
+    frames = 0;
+    *seed = header.seed;
+    return true;
+}
+
+void InputRecorder::Stop()
+{
+    if (file == nullptr)
+    {
+        return;
+    }
+    if (recording)
+    {
+        Input::SetEventHook(nullptr, nullptr);
+    }
+    SDL_RWclose(file);
+    file = nullptr;
+    recording = false;
+}
+
+void InputRecorder::RecordEvent(const SDL_Event& event, void* userData)
+{
+    InputRecorder* recorder = static_cast<InputRecorder*>(userData);
+    if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP)
+    {
+        recorder->pending.push_back({event.type, event.key.timestamp, static_cast<uint16_t>(event.key.keysym.scancode), event.key.state});
+    }
+    else if (event.type == SDL_CONTROLLERBUTTONDOWN || event.type == SDL_CONTROLLERBUTTONUP)
+    {
+        recorder->pending.push_back({event.type, event.cbutton.timestamp, event.cbutton.button, event.cbutton.state});
+    }
+}
+
+void InputRecorder::WriteFrame(const InputLogFrame& frame)
+{
+    assert(IsRecording());
+
+    // A frame with more events than fit the count keeps the first ones, Input drops most of those anyway
+    InputLogFrame record = frame;
+    record.eventCount = static_cast<uint16_t>(pending.size() < UINT16_MAX ? pending.size() : UINT16_MAX);
+
+    bool written = SDL_RWwrite(file, &record, sizeof(record), 1) == 1;
+    if (written && record.eventCount > 0)
+    {
+        written = SDL_RWwrite(file, pending.data(), sizeof(InputLogEvent), record.eventCount) == record.eventCount;
+    }
+    pending.clear();
+    frames++;
+
+    if (!written)
+    {
+        LOG(LOG_ERROR, "Could not write the input log, recording stopped");
+        Stop();
+    }
+}
+
+bool InputRecorder::ReadFrame(InputLogFrame& frame)
+{
+    assert(IsReplaying());
+
+    if (SDL_RWread(file, &frame, sizeof(frame), 1) != 1)
+    {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < frame.eventCount; i++)
+    {
+        InputLogEvent logged;
+        if (SDL_RWread(file, &logged, sizeof(logged), 1) != 1)
+        {
+            LOG(LOG_WARNING, "Input log ends in the middle of a frame");
+            return false;
+        }
+
+        SDL_Event event = {.type = logged.type};
+        if (logged.type == SDL_KEYDOWN || logged.type == SDL_KEYUP)
+        {
+            event.key.timestamp = logged.timestamp;
+            event.key.state = logged.down;
+            event.key.keysym.scancode = static_cast<SDL_Scancode>(logged.code);
+        }
+        else
+        {
+            event.cbutton.timestamp = logged.timestamp;
+            event.cbutton.button = static_cast<Uint8>(logged.code);
+            event.cbutton.state = logged.down;
+        }
+        Input::HandleEvent(event);
+    }
+
+    frames++;
+    return true;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#ifndef INPUT_RECORDER_HPP
+#define INPUT_RECORDER_HPP
+
+#include "SDL_events.h"
+#include "SDL_rwops.h"
+#include <cstdint>
+#include <vector>
+
+// Input log file, little endian:
+//   InputLogHeader
+//   per frame: InputLogFrame, then eventCount InputLogEvent
+constexpr uint32_t InputLogMagic = 0x52495053; // "SPIR"
+constexpr uint32_t InputLogVersion = 3;
+
+#pragma pack(push, 1)
+struct InputLogHeader{
+    uint32_t magic;
+    uint32_t version;
+    // NewGame seed of the recorded session
+    uint32_t seed;
+    uint32_t _reserved;
+};
+
+struct InputLogFrame{
+    double deltaTime;
+    // Input::GetFrameEndTicks of the frame
+    uint32_t ticks;
+    // Gamepad paddle axes the frame used, they come from the poll thread rather than events
+    float gamepadLeft;
+    float gamepadRight;
+    uint16_t eventCount;
+};
+
+// The parts of a key or controller button SDL_Event that Input reads
+struct InputLogEvent{
+    uint32_t type;
+    uint32_t timestamp;
+    uint16_t code;
+    uint8_t down;
+};
+#pragma pack(pop)
+
+// Records everything Input applies plus each frame's delta time into a compact log, and plays
+// such a log back through Input::HandleEvent so a session can be rerun without a user
+class InputRecorder
+{
+private:
+    SDL_RWops* file = nullptr;
+    bool recording = false;
+    // Events applied since the last WriteFrame
+    std::vector<InputLogEvent> pending;
+    uint64_t frames = 0;
+
+    static void RecordEvent(const SDL_Event& event, void* userData);
+public:
+    InputRecorder() = default;
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+    ~InputRecorder() { Stop(); }
+
+    // Hooks into Input, call WriteFrame once per frame after Input::FinishEvents
+    bool StartRecording(const char* path, uint32_t seed);
+    // Returns the seed the recorded session started with. Input's event watch should be
+    // off so only the log reaches Input
+    bool StartReplay(const char* path, uint32_t* seed);
+    void Stop();
+
+    bool IsRecording() const { return file != nullptr && recording; }
+    bool IsReplaying() const { return file != nullptr && !recording; }
+    uint64_t GetFrameCount() const { return frames; }
+
+    void WriteFrame(const InputLogFrame& frame);
+    // Call after Input::UpdateFrame, feeds the next frame's events through Input::HandleEvent.
+    // The caller finishes the frame with Input::FinishEvents(frame.ticks). False at the end of the log
+    bool ReadFrame(InputLogFrame& frame);
+};
+
+#endif // INPUT_RECORDER_HPP
@@ -0,0 +1,160 @@
+#include "latency_tracker.hpp"
+#include "SDL.h"
+#include <cassert>
+
+#include "logging.h"
+
+static const char* StageNames[] = {"input", "simulation", "submit", "present", "total"};
+static_assert(sizeof(StageNames) / sizeof(StageNames[0]) == static_cast<int>(LatencyStage::Count), "Missing latency stage name");
+
+void LatencyTracker::Initialize()
+{
+    ticksToMilliseconds = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+}
+
+void LatencyTracker::Add(LatencyStage stage, uint64_t ticks)
+{
+    int index = static_cast<int>(stage);
+    int bucket = static_cast<int>(ticks * ticksToMilliseconds / BucketMilliseconds);
+    buckets[index][bucket < BucketCount ? bucket : BucketCount - 1]++;
+    samples[index]++;
+    if (ticks > maxTicks[index])
+    {
+        maxTicks[index] = ticks;
+    }
+}
+
+void LatencyTracker::MarkApplied(const Input::KeyEvent* events, int count, uint64_t now)
+{
+    assert(ticksToMilliseconds > 0.0 && "LatencyTracker::Initialize wasn't called");
+
+    // Events still pending from frames without a tick stay, new ones queue behind them
+    for (int i = 0; i < count && pendingCount < MaxFrameEvents; i++)
+    {
+        // Events without a capture time, like replayed ones, or from another clock would only skew the histograms
+        if (events[i].captureTicks != Input::UnknownCaptureTicks && events[i].captureTicks <= now)
+        {
+            pending[pendingCount++] = {.capturedTicks = events[i].captureTicks, .appliedTicks = now};
+        }
+    }
+}
+
+void LatencyTracker::MarkSimulated(uint64_t now)
+{
+    for (int i = 0; i < pendingCount && simulatedCount < MaxFrameEvents; i++)
+    {
+        simulated[simulatedCount++] = pending[i];
+    }
+    pendingCount = 0;
+    simulatedTicks = now;
+}
+
+void LatencyTracker::MarkSubmitted(uint64_t now)
+{
+    submittedTicks = now;
+}
+
+void LatencyTracker::MarkPresented(uint64_t now)
+{
+    for (int i = 0; i < simulatedCount; i++)
+    {
+        const TracedEvent& event = simulated[i];
+        Add(LatencyStage::Input, event.appliedTicks - event.capturedTicks);
+        Add(LatencyStage::Simulation, simulatedTicks - event.appliedTicks);
+        Add(LatencyStage::Submit, submittedTicks - simulatedTicks);
+        Add(LatencyStage::Present, now - submittedTicks);
+        Add(LatencyStage::Total, now - event.capturedTicks);
+    }
+    simulatedCount = 0;
+}
+
+LatencySummary LatencyTracker::GetSummary(LatencyStage stage) const
+{
+    int index = static_cast<int>(stage);
+    LatencySummary summary = {.samples = samples[index], .maxMilliseconds = maxTicks[index] * ticksToMilliseconds};
+    if (summary.samples == 0)
+    {
+        return summary;
+    }
+
+    // Percentiles are reported as the upper edge of the bucket they fall into
+    double* targets[] = {&summary.p50Milliseconds, &summary.p95Milliseconds, &summary.p99Milliseconds};
+    const double fractions[] = {0.50, 0.95, 0.99};
+    int target = 0;
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < BucketCount && target < 3; bucket++)
+    {
+        seen += buckets[index][bucket];
+        while (target < 3 && seen >= fractions[target] * summary.samples)
+        {
+            double edge = (bucket + 1) * BucketMilliseconds;
+            *targets[target++] = edge < summary.maxMilliseconds ? edge : summary.maxMilliseconds;
+        }
+    }
+    return summary;
+}
+
+void LatencyTracker::LogSummary() const
+{
+    for (int stage = 0; stage < static_cast<int>(LatencyStage::Count); stage++)
+    {
+        LatencySummary summary = GetSummary(static_cast<LatencyStage>(stage));
+        char message[160];
+        SDL_snprintf(message, sizeof(message), "Latency %s: %llu events, p50 %.2fms p95 %.2fms p99 %.2fms max %.2fms",
+            StageNames[stage], (unsigned long long)summary.samples,
+            summary.p50Milliseconds, summary.p95Milliseconds, summary.p99Milliseconds, summary.maxMilliseconds);
+        LOG(LOG_INFO, message);
+    }
+}
+
+bool LatencyTracker::WriteCsv(const char* path) const
+{
+    SDL_RWops* file = SDL_RWFromFile(path, "wb");
+    if (file == nullptr)
+    {
+        LOG(LOG_ERROR, "Could not open the latency csv");
+        SDL_ClearError();
+        return false;
+    }
+
+    char line[256];
+    int length = SDL_snprintf(line, sizeof(line), "bucket_ms");
+    for (const char* name : StageNames)
+    {
+        length += SDL_snprintf(line + length, sizeof(line) - length, ",%s", name);
+    }
+    length += SDL_snprintf(line + length, sizeof(line) - length, "\n");
+    bool written = SDL_RWwrite(file, line, 1, length) == static_cast<size_t>(length);
+
+    // Only rows up to the slowest sample, the rest would all be zero
+    int lastBucket = 0;
+    for (int stage = 0; stage < static_cast<int>(LatencyStage::Count); stage++)
+    {
+        for (int bucket = BucketCount - 1; bucket > lastBucket; bucket--)
+        {
+            if (buckets[stage][bucket] != 0)
+            {
+                lastBucket = bucket;
+                break;
+            }
+        }
+    }
+
+    for (int bucket = 0; bucket <= lastBucket && written; bucket++)
+    {
+        length = SDL_snprintf(line, sizeof(line), "%.2f", bucket * BucketMilliseconds);
+        for (int stage = 0; stage < static_cast<int>(LatencyStage::Count); stage++)
+        {
+            length += SDL_snprintf(line + length, sizeof(line) - length, ",%u", buckets[stage][bucket]);
+        }
+        length += SDL_snprintf(line + length, sizeof(line) - length, "\n");
+        written = SDL_RWwrite(file, line, 1, length) == static_cast<size_t>(length);
+    }
+
+    SDL_RWclose(file);
+    if (!written)
+    {
+        LOG(LOG_ERROR, "Could not write the latency csv");
+    }
+    return written;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#ifndef LATENCY_TRACKER_HPP
+#define LATENCY_TRACKER_HPP
+
+#include "input.hpp"
+#include <cstdint>
+
+enum class LatencyStage{
+    // Event watch capture until Input::FinishEvents applied it
+    Input,
+    // Applied until the simulation update that consumed it finished, frames that run no
+    // simulation tick carry their events over to the next one that does
+    Simulation,
+    // Simulation until the frame's draws were submitted
+    Submit,
+    // Submission until SDL_GL_SwapWindow returned
+    Present,
+    // Capture until SDL_GL_SwapWindow returned
+    Total,
+    Count
+};
+
+struct LatencySummary{
+    uint64_t samples;
+    double p50Milliseconds;
+    double p95Milliseconds;
+    double p99Milliseconds;
+    double maxMilliseconds;
+};
+
+// Traces input events from capture to the buffer swap that shows their effect and keeps a
+// histogram per stage. Every event consumed by a frame's simulation shares that frame's later stage timestamps.
+// All times are SDL_GetPerformanceCounter values
+class LatencyTracker
+{
+public:
+    // Fixed width buckets, anything slower lands in the last one
+    static constexpr int BucketCount = 512;
+    static constexpr double BucketMilliseconds = 0.25;
+    static constexpr int MaxFrameEvents = 64;
+
+private:
+    uint32_t buckets[static_cast<int>(LatencyStage::Count)][BucketCount] = {};
+    uint64_t samples[static_cast<int>(LatencyStage::Count)] = {};
+    uint64_t maxTicks[static_cast<int>(LatencyStage::Count)] = {};
+
+    struct TracedEvent{
+        uint64_t capturedTicks;
+        uint64_t appliedTicks;
+    };
+    // Applied but not yet consumed by a simulation tick
+    TracedEvent pending[MaxFrameEvents];
+    int pendingCount = 0;
+    // Consumed by this frame's simulation, waiting for the frame to be presented
+    TracedEvent simulated[MaxFrameEvents];
+    int simulatedCount = 0;
+    uint64_t simulatedTicks = 0;
+    uint64_t submittedTicks = 0;
+
+    double ticksToMilliseconds = 0.0;
+
+    void Add(LatencyStage stage, uint64_t ticks);
+public:
+    void Initialize();
+
+    // Starts tracing this frame's key events, call once after Input::FinishEvents
+    void MarkApplied(const Input::KeyEvent* events, int count, uint64_t now);
+    // Call only on frames that ran at least one simulation tick, the events applied so far were consumed by it
+    void MarkSimulated(uint64_t now);
+    void MarkSubmitted(uint64_t now);
+    // Closes the frame and adds the events its simulation consumed to the histograms
+    void MarkPresented(uint64_t now);
+
+    LatencySummary GetSummary(LatencyStage stage) const;
+    // Writes every stage's summary through LOG
+    void LogSummary() const;
+    // One row per bucket with the count of every stage
+    bool WriteCsv(const char* path) const;
+};
+
+#endif // LATENCY_TRACKER_HPP
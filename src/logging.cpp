@@ -0,0 +1,33 @@
+#include "logging.h"
+#include "SDL_atomic.h"
+
+// Held while the sink is called, so once SetLogSink returns no thread is still inside the old one
+static SDL_SpinLock gLogSinkLock = 0;
+static LogSink gLogSink = nullptr;
+static void* gLogSinkUserData = nullptr;
+
+void log_func(const char* tag, uint32_t logLevel, uint32_t logItemId, const char* message, uint32_t lineNumber, const char* filename, void* userData)
+{
+    slog_func(tag, logLevel, logItemId, message, lineNumber, filename, userData);
+
+    // sokol's own messages only carry an item id in release builds
+    if (message == nullptr)
+    {
+        return;
+    }
+
+    SDL_AtomicLock(&gLogSinkLock);
+    if (gLogSink != nullptr)
+    {
+        gLogSink(logLevel, message, gLogSinkUserData);
+    }
+    SDL_AtomicUnlock(&gLogSinkLock);
+}
+
+void SetLogSink(LogSink sink, void* userData)
+{
+    SDL_AtomicLock(&gLogSinkLock);
+    gLogSink = sink;
+    gLogSinkUserData = userData;
+    SDL_AtomicUnlock(&gLogSinkLock);
+}
@@ -4,13 +4,14 @@
 #define LOGGING_H
 
 #include "sokol_log.h"
+#include <cstdint>
 
 
 #if defined(_DEBUG)
-    #define LOG(logLevel, msg) slog_func(nullptr, logLevel, 0, msg, __LINE__, __FILE__, nullptr)
-    #define DEBUG_LOG(msg) slog_func(nullptr, LOG_DEBUG, 0, msg, __LINE__, __FILE__, nullptr)
+    #define LOG(logLevel, msg) log_func(nullptr, logLevel, 0, msg, __LINE__, __FILE__, nullptr)
+    #define DEBUG_LOG(msg) log_func(nullptr, LOG_DEBUG, 0, msg, __LINE__, __FILE__, nullptr)
 #else
-    #define LOG(logLevel, msg) slog_func(nullptr, logLevel, 0, msg, __LINE__, nullptr, nullptr)
+    #define LOG(logLevel, msg) log_func(nullptr, logLevel, 0, msg, __LINE__, nullptr, nullptr)
     #define DEBUG_LOG(msg) 
 #endif
 
@@ -22,4 +23,14 @@ enum LogLevel{
     LOG_DEBUG
 };
 
+// Receives every message that goes through log_func, may be called from any thread.
+// Calls are serialized and a sink must not log itself
+typedef void (*LogSink)(uint32_t logLevel, const char* message, void* userData);
+
+// Same signature as slog_func so sokol can log through it too. Writes to slog_func and
+// then hands the message to the sink, if one is set
+void log_func(const char* tag, uint32_t logLevel, uint32_t logItemId, const char* message, uint32_t lineNumber, const char* filename, void* userData);
+// Waits for a call into the previous sink to finish, after clearing it the sink's user data can go away
+void SetLogSink(LogSink sink, void* userData);
+
 #endif // LOGGING_H
\ No newline at end of file
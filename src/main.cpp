@@ -11,7 +11,13 @@
 #include "math_types.hpp"
 #include "renderer.hpp"
 #include "input.hpp"
+#include "gamepad_poller.hpp"
+#include "latency_tracker.hpp"
+#include "input_recorder.hpp"
 #include "game_state.hpp"
+#include "simulation.hpp"
+#include "console.hpp"
+#include "logging.h"
 
 #include <ctime>
 
@@ -39,12 +45,10 @@ double GetTime()
     return (SDL_GetPerformanceCounter() - gAppState.startTicks) / static_cast<double>(SDL_GetPerformanceFrequency());
 }
 
-void FitGameArea(Camera2D& camera)
+void FitGameArea(Camera2D& camera, Vector2 viewportSize)
 {
-    int width, height;
-    SDL_GL_GetDrawableSize(sdl_window(), &width, &height);
-    float horizontalRatio = width / gGameParams.gameSize.X;
-    float verticalRatio = height / gGameParams.gameSize.Y;
+    float horizontalRatio = viewportSize.X / gGameParams.gameSize.X;
+    float verticalRatio = viewportSize.Y / gGameParams.gameSize.Y;
     if (horizontalRatio < verticalRatio)
     {
         // Fit width
@@ -57,129 +61,255 @@ void FitGameArea(Camera2D& camera)
     }
 }
 
-void ResetGameElements()
+void BuildStaticSprites(SpriteLayer& layer)
 {
-    gGameState.paddlePositionLeft = {-gGameParams.gameSize.X * 0.45f - gGameParams.paddleSize.X * 0.5f, gGameParams.paddleSize.Y * -0.5f};
-    gGameState.paddlePositionRight = {gGameParams.gameSize.X * 0.45f - gGameParams.paddleSize.X * 0.5f, gGameParams.paddleSize.Y * -0.5f};
+    Vector2 gameAreaSize = gGameParams.gameSize;
+    layer.Initialize(gameAreaSize * -0.5f, gameAreaSize, 64.f);
 
+    // Top and Bottom walls
+    layer.Add({.position = {-gameAreaSize.X * 0.5f, gameAreaSize.Y * 0.5f}, .size = {gameAreaSize.X, -gGameParams.wallThickness}, .color = gGameParams.wallColor});
+    layer.Add({.position = {-gameAreaSize.X * 0.5f, -gameAreaSize.Y * 0.5f}, .size = {gameAreaSize.X, gGameParams.wallThickness}, .color = gGameParams.wallColor});
 
-    gGameState.ballPosition = {gGameParams.ballSize * -0.5f};
-    float randFloat = (rand() / static_cast<float>(RAND_MAX));
-    if (randFloat < 0.5f)
+    // Center line
+    float lineHeight = (gameAreaSize.Y - gGameParams.lineGap * (gGameParams.lineSegments - 1)) / gGameParams.lineSegments;
+    for (int i = 0; i < gGameParams.lineSegments; i++)
     {
-        float angle = (randFloat - 0.25f) * HMM_PI32;
-        gGameState.ballVelocity = HMM_RotateV2({gGameParams.ballSpeed, 0}, angle);
-    }
-    else
-    {
-        float angle = (randFloat - 0.75f) * HMM_PI32;
-        gGameState.ballVelocity = HMM_RotateV2({-gGameParams.ballSpeed, 0}, angle);
+        layer.Add({.position = {-gGameParams.lineThickness * 0.5f, -gGameParams.gameHeight * 0.5f + (lineHeight + gGameParams.lineGap) * i}, .size = {gGameParams.lineThickness, lineHeight}, .color = gGameParams.lineColor});
     }
 }
 
-bool CheckCollisionRectangles(Vector2 position1, Vector2 size1, Vector2 position2, Vector2 size2)
-{
-    return ((position1.X < (position2.X + size2.X) && (position1.X + size1.X) > position2.X) &&
-        (position1.Y < (position2.Y + size2.Y) && (position1.Y + size1.Y) > position2.Y));
-}
+// Actions bound to single keys, checked together with one bulk test per frame
+enum Hotkey{
+    HOTKEY_FULLSCREEN,
+    HOTKEY_BLOOM,
+    HOTKEY_CRT,
+    HOTKEY_STATS,
+    HOTKEY_CAPTURE,
+    HOTKEY_COUNT
+};
+
+constexpr Input::KeySet HotkeyKeys[HOTKEY_COUNT] = {
+    Input::MakeKeySet({SDL_SCANCODE_F11}),
+    Input::MakeKeySet({SDL_SCANCODE_F3}),
+    Input::MakeKeySet({SDL_SCANCODE_F4}),
+    Input::MakeKeySet({SDL_SCANCODE_F5}),
+    Input::MakeKeySet({SDL_SCANCODE_F9}),
+};
+
+constexpr int DigitFontWidth = 3;
+constexpr int DigitFontHeight = 5;
+constexpr int DigitCellCount = DigitFontWidth * DigitFontHeight;
+constexpr bool DigitCells[] = {
+    // 0
+    1, 1, 1,
+    1, 0, 1,
+    1, 0, 1,
+    1, 0, 1,
+    1, 1, 1,
+    
+    // 1
+    0, 1, 1,
+    0, 0, 1,
+    0, 0, 1,
+    0, 0, 1,
+    0, 0, 1,
+
+    // 2
+    1, 1, 1,
+    0, 0, 1,
+    1, 1, 1,
+    1, 0, 0,
+    1, 1, 1,
+
+    // 3
+    1, 1, 1,
+    0, 0, 1,
+    1, 1, 1,
+    0, 0, 1,
+    1, 1, 1,
+
+    // 4
+    1, 0, 1,
+    1, 0, 1,
+    1, 1, 1,
+    0, 0, 1,
+    0, 0, 1,
+    
+    // 5
+    1, 1, 1,
+    1, 0, 0,
+    1, 1, 1,
+    0, 0, 1,
+    1, 1, 1,
+
+    // 6
+    1, 1, 1,
+    1, 0, 0,
+    1, 1, 1,
+    1, 0, 1,
+    1, 1, 1,
+
+    // 7
+    1, 1, 1,
+    0, 0, 1,
+    0, 1, 0,
+    0, 1, 0,
+    0, 1, 0,
+
+    // 8
+    1, 1, 1,
+    1, 0, 1,
+    1, 1, 1,
+    1, 0, 1,
+    1, 1, 1,
+
+    // 9
+    1, 1, 1,
+    1, 0, 1,
+    1, 1, 1,
+    0, 0, 1,
+    0, 0, 1,
+};
+
+// A run of lit cells in the digit font, in cells from the top left
+struct DigitRect{
+    int x, y;
+    int width, height;
+};
 
-void DrawDigit(int digit, Renderer& renderer, Vector2 position, Vector2 size, Color color)
-{
-    assert(digit < 10);
-
-    constexpr int FontWidth = 3;
-    constexpr int FontHeight = 5;
-    constexpr int FontDigitLength = FontWidth * FontHeight;
-    constexpr bool Digits[] = {
-        // 0
-        1, 1, 1,
-        1, 0, 1,
-        1, 0, 1,
-        1, 0, 1,
-        1, 1, 1,
-        
-        // 1
-        0, 1, 1,
-        0, 0, 1,
-        0, 0, 1,
-        0, 0, 1,
-        0, 0, 1,
-
-        // 2
-        1, 1, 1,
-        0, 0, 1,
-        1, 1, 1,
-        1, 0, 0,
-        1, 1, 1,
-
-        // 3
-        1, 1, 1,
-        0, 0, 1,
-        1, 1, 1,
-        0, 0, 1,
-        1, 1, 1,
-
-        // 4
-        1, 0, 1,
-        1, 0, 1,
-        1, 1, 1,
-        0, 0, 1,
-        0, 0, 1,
-        
-        // 5
-        1, 1, 1,
-        1, 0, 0,
-        1, 1, 1,
-        0, 0, 1,
-        1, 1, 1,
-
-        // 6
-        1, 1, 1,
-        1, 0, 0,
-        1, 1, 1,
-        1, 0, 1,
-        1, 1, 1,
-
-        // 7
-        1, 1, 1,
-        0, 0, 1,
-        0, 1, 0,
-        0, 1, 0,
-        0, 1, 0,
-
-        // 8
-        1, 1, 1,
-        1, 0, 1,
-        1, 1, 1,
-        1, 0, 1,
-        1, 1, 1,
-
-        // 9
-        1, 1, 1,
-        1, 0, 1,
-        1, 1, 1,
-        0, 0, 1,
-        0, 0, 1,
-    };
+struct DigitMesh{
+    DigitRect rects[DigitCellCount];
+    int count;
+};
 
-    float pixelWidth = size.X / FontWidth;
-    float pixelHeight = size.Y / FontHeight;
+// Greedy meshing: grow each unvisited lit cell right as far as possible,
+// then down while the whole span stays lit
+constexpr DigitMesh MeshDigit(int digit)
+{
+    const bool* cells = DigitCells + DigitCellCount * digit;
+    bool covered[DigitCellCount] = {};
+    DigitMesh mesh = {};
 
-    int offset = FontDigitLength * digit;
-    for (int y = 0; y < FontHeight; y++)
+    for (int y = 0; y < DigitFontHeight; y++)
     {
-        for (int x = 0; x < FontWidth; x++)
+        for (int x = 0; x < DigitFontWidth; x++)
         {
-            if(!Digits[offset + y * FontWidth + x])
+            if (!cells[y * DigitFontWidth + x] || covered[y * DigitFontWidth + x])
             {
                 continue;
             }
-            
-            renderer.DrawRectangle(position + Vector2{pixelWidth * x, size.Y - pixelHeight * (y + 1)}, {pixelWidth, pixelHeight}, color);
+
+            int width = 1;
+            while (x + width < DigitFontWidth && cells[y * DigitFontWidth + x + width] && !covered[y * DigitFontWidth + x + width])
+            {
+                width++;
+            }
+
+            int height = 1;
+            for (bool spanLit = true; spanLit && y + height < DigitFontHeight;)
+            {
+                for (int i = x; i < x + width; i++)
+                {
+                    spanLit = spanLit && cells[(y + height) * DigitFontWidth + i] && !covered[(y + height) * DigitFontWidth + i];
+                }
+                if (spanLit)
+                {
+                    height++;
+                }
+            }
+
+            for (int row = y; row < y + height; row++)
+            {
+                for (int column = x; column < x + width; column++)
+                {
+                    covered[row * DigitFontWidth + column] = true;
+                }
+            }
+            mesh.rects[mesh.count++] = {x, y, width, height};
         }
     }
-    
+    return mesh;
+}
+
+constexpr DigitMesh DigitMeshes[] = {
+    MeshDigit(0), MeshDigit(1), MeshDigit(2), MeshDigit(3), MeshDigit(4),
+    MeshDigit(5), MeshDigit(6), MeshDigit(7), MeshDigit(8), MeshDigit(9),
+};
+
+static_assert([]{
+    for (const DigitMesh& mesh : DigitMeshes)
+    {
+        if (mesh.count < 1 || mesh.count > 5) return false;
+    }
+    return true;
+}(), "Every digit should mesh into 1 to 5 rectangles");
 
+void DrawDigit(int digit, Renderer& renderer, Vector2 position, Vector2 size, Color color)
+{
+    assert(digit >= 0 && digit < 10);
+
+    float pixelWidth = size.X / DigitFontWidth;
+    float pixelHeight = size.Y / DigitFontHeight;
+
+    const DigitMesh& mesh = DigitMeshes[digit];
+    for (int i = 0; i < mesh.count; i++)
+    {
+        const DigitRect& rect = mesh.rects[i];
+        // Rows count down from the top while world space y points up
+        renderer.DrawRectangle(
+            position + Vector2{pixelWidth * rect.x, size.Y - pixelHeight * (rect.y + rect.height)},
+            {pixelWidth * rect.width, pixelHeight * rect.height},
+            color
+        );
+    }
+}
+
+// Draws every digit of a non-negative number with one empty font cell between digits. Left alignment
+// puts the first digit at position, Right alignment ends the last digit at position.X + size.X
+void DrawNumber(int value, Renderer& renderer, Vector2 position, Vector2 size, Color color, FontAlignment alignment = FontAlignment::Left)
+{
+    assert(value >= 0);
+
+    int digits[10];
+    int digitCount = 0;
+    do
+    {
+        digits[digitCount++] = value % 10;
+        value /= 10;
+    } while (value > 0);
+
+    float advance = size.X + size.X / DigitFontWidth;
+    if (alignment == FontAlignment::Right)
+    {
+        position.X -= advance * (digitCount - 1);
+    }
+    else if (alignment == FontAlignment::Center)
+    {
+        position.X -= (advance * (digitCount - 1)) * 0.5f;
+    }
+
+    for (int i = digitCount - 1; i >= 0; i--)
+    {
+        DrawDigit(digits[i], renderer, position, size, color);
+        position.X += advance;
+    }
+}
+
+// Positions in floats for drawing, the rest of the state is drawn from the current tick
+struct GameDrawState{
+    Vector2 paddlePositionLeft;
+    Vector2 paddlePositionRight;
+    Vector2 ballPosition;
+};
+
+// Positions a fraction alpha of the way from the previous tick to the current one
+GameDrawState InterpolateGameState(const GameState& previous, const GameState& current, float alpha)
+{
+    return {
+        .paddlePositionLeft = HMM_LerpV2(FixedVector2ToVector2(previous.paddlePositionLeft), alpha, FixedVector2ToVector2(current.paddlePositionLeft)),
+        .paddlePositionRight = HMM_LerpV2(FixedVector2ToVector2(previous.paddlePositionRight), alpha, FixedVector2ToVector2(current.paddlePositionRight)),
+        .ballPosition = HMM_LerpV2(FixedVector2ToVector2(previous.ballPosition), alpha, FixedVector2ToVector2(current.ballPosition)),
+    };
 }
 
 int SDL_main( int argc, char* args[] )
@@ -189,19 +319,102 @@ int SDL_main( int argc, char* args[] )
     bool success = sdl_init(&sdl_desc);
     assert(success);
 
-    srand(time(NULL));
+    // --record <file> logs all input of the session, --replay <file> plays such a log back instead of reading devices
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (SDL_strcmp(args[i], "--record") == 0)
+        {
+            recordPath = args[++i];
+        }
+        else if (SDL_strcmp(args[i], "--replay") == 0)
+        {
+            replayPath = args[++i];
+        }
+    }
+
+    uint32_t seed = static_cast<uint32_t>(time(NULL));
+    InputRecorder recorder;
+    if (replayPath != nullptr && !recorder.StartReplay(replayPath, &seed))
+    {
+        return 1;
+    }
+    bool replaying = recorder.IsReplaying();
+    if (recordPath != nullptr && !replaying)
+    {
+        recorder.StartRecording(recordPath, seed);
+    }
+
+    // Sticks are sampled at 1 kHz and averaged over each frame. A replay brings its own input
+    GamepadPoller gamepads;
+    if (!replaying)
+    {
+        Input::Initialize();
+        gamepads.Start(1000);
+    }
+    Uint64 inputTicks = SDL_GetPerformanceCounter();
+
+    LatencyTracker latency;
+    latency.Initialize();
+
+    RenderContext renderContext{};
+    renderContext.Initialize();
+    renderContext.SetClearColor(ColorFromHex(0x181818FF));
 
     Renderer renderer{};
-    renderer.Initialize();
-    // TODO: move clear color to application layer? Because we will want to have multiple renderers later
-    renderer.SetClearColor(ColorFromHex(0x181818FF));
+    renderer.Initialize(&renderContext);
    
     gAppState.startTicks = SDL_GetPerformanceCounter();
     gAppState.lastFrameTicks = gAppState.startTicks;
 
-    renderer.LoadFont(RESOURCES_PATH "Kenney Pixel.ttf", 64.f);
-
-    ResetGameElements();
+    renderContext.LoadFont(RESOURCES_PATH "Kenney Pixel.ttf", 64.f, FontMode::DistanceField, RESOURCES_PATH "Kenney Pixel.fontbin");
+    // Same distance field glyphs at a smaller size, the handle shares the atlas pages of the one above
+    Font consoleFont = renderContext.LoadFont(RESOURCES_PATH "Kenney Pixel.ttf", 20.f, FontMode::DistanceField, RESOURCES_PATH "Kenney Pixel.fontbin");
+
+    gGameState = NewGame(seed);
+
+    Console console;
+    console.Initialize();
+    console.SetFont(consoleFont);
+    console.RegisterCommand("bloom", [](const char*, void* userData) {
+        PostProcess& postProcess = static_cast<RenderContext*>(userData)->GetPostProcess();
+        postProcess.SetStageEnabled(PostStage::Bloom, !postProcess.IsStageEnabled(PostStage::Bloom));
+    }, &renderContext, "Toggles bloom");
+    console.RegisterCommand("crt", [](const char*, void* userData) {
+        PostProcess& postProcess = static_cast<RenderContext*>(userData)->GetPostProcess();
+        postProcess.SetStageEnabled(PostStage::Crt, !postProcess.IsStageEnabled(PostStage::Crt));
+    }, &renderContext, "Toggles the CRT effect");
+    bool showFrameTime = false;
+    console.RegisterCommand("fps", [](const char*, void* userData) {
+        bool* show = static_cast<bool*>(userData);
+        *show = !*show;
+    }, &showFrameTime, "Toggles the frame time display");
+    console.RegisterCommand("latency", [](const char* args, void* userData) {
+        LatencyTracker* latency = static_cast<LatencyTracker*>(userData);
+        latency->LogSummary();
+        if (*args != '\0')
+        {
+            latency->WriteCsv(args);
+        }
+    }, &latency, "Logs input latency percentiles, latency <file> also writes the histograms as csv");
+
+    SpriteLayer staticSprites;
+    BuildStaticSprites(staticSprites);
+    renderer.SetSpriteLayer(&staticSprites);
+
+    // Time not yet simulated, always less than one tick after the tick loop
+    double tickAccumulator = 0.0;
+    GameState previousGameState = gGameState;
+    bool startPending = false;
+    // Paddle input since the last tick, each frame's average weighted by the time it covers.
+    // Keys are weighted in SDL_GetTicks milliseconds, gamepads in seconds
+    float keyHeldLeft = 0.f;
+    float keyHeldRight = 0.f;
+    uint32_t keySpan = 0;
+    float gamepadHeldLeft = 0.f;
+    float gamepadHeldRight = 0.f;
+    double gamepadSpan = 0.0;
 
     bool quit = false;
     SDL_Event e;
@@ -218,10 +431,57 @@ int SDL_main( int argc, char* args[] )
                 quit = true;
             }
 
-            Input::HandleEvent(e);
+            if (!replaying && !console.HandleEvent(e))
+            {
+                Input::HandleEvent(e);
+            }
+        }
+
+        Uint64 previousInputTicks = inputTicks;
+        inputTicks = SDL_GetPerformanceCounter();
+        float gamepadLeft = 0.f;
+        float gamepadRight = 0.f;
+        if (replaying)
+        {
+            InputLogFrame frame;
+            if (!recorder.ReadFrame(frame))
+            {
+                char message[128];
+                SDL_snprintf(message, sizeof(message), "Replay finished: %llu frames in %.2fs",
+                    (unsigned long long)recorder.GetFrameCount(), GetTime());
+                LOG(LOG_INFO, message);
+                break;
+            }
+            Input::FinishEvents(frame.ticks);
+            deltaTime = frame.deltaTime;
+            gamepadLeft = frame.gamepadLeft;
+            gamepadRight = frame.gamepadRight;
+        }
+        else
+        {
+            // Keys typed into the console shouldn't move the paddles
+            Input::SetEnabled(!console.IsOpen());
+            Input::FinishEvents();
+            // Stick y points down, the first gamepad plays left and the second right
+            if (!console.IsOpen())
+            {
+                gamepadLeft = -gamepads.GetAxisAverage(0, SDL_CONTROLLER_AXIS_LEFTY, previousInputTicks, inputTicks);
+                gamepadRight = -gamepads.GetAxisAverage(1, SDL_CONTROLLER_AXIS_LEFTY, previousInputTicks, inputTicks);
+            }
+            if (recorder.IsRecording())
+            {
+                recorder.WriteFrame({deltaTime, Input::GetFrameEndTicks(), gamepadLeft, gamepadRight});
+            }
         }
+        int keyEventCount;
+        const Input::KeyEvent* keyEvents = Input::GetKeyEvents(&keyEventCount);
+        latency.MarkApplied(keyEvents, keyEventCount, inputTicks);
+        bool startPressed = Input::IsKeyJustPressed(SDL_SCANCODE_SPACE) || Input::IsButtonJustPressed(SDL_CONTROLLER_BUTTON_A);
 
-        if(Input::IsKeyJustPressed(SDL_SCANCODE_F11))
+        // Most frames press nothing, one bulk test skips all hotkey checks
+        uint32_t hotkeys = Input::IsAnyKeyJustPressed() ? Input::GetActionsJustPressed(HotkeyKeys, HOTKEY_COUNT) : 0;
+
+        if(hotkeys & (1u << HOTKEY_FULLSCREEN))
         {
             Uint32 windowFlags = SDL_GetWindowFlags(sdl_window());
             if (windowFlags & SDL_WINDOW_FULLSCREEN_DESKTOP > 0)
@@ -234,115 +494,133 @@ int SDL_main( int argc, char* args[] )
             }
         }
 
-        if (gGameState.state == PONG_WAITING)
+        PostProcess& postProcess = renderContext.GetPostProcess();
+        if(hotkeys & (1u << HOTKEY_BLOOM))
         {
-            if(Input::IsKeyJustPressed(SDL_SCANCODE_SPACE))
-            {
-                gGameState.state = PONG_PLAYING;
-            }
+            postProcess.SetStageEnabled(PostStage::Bloom, !postProcess.IsStageEnabled(PostStage::Bloom));
         }
-        else if (gGameState.state == PONG_PLAYING)
+        if(hotkeys & (1u << HOTKEY_CRT))
         {
-            float inputLeft = Input::GetAxis(SDL_SCANCODE_S, SDL_SCANCODE_W);
-            float inputRight = Input::GetAxis(SDL_SCANCODE_DOWN, SDL_SCANCODE_UP);
-
-            gGameState.paddlePositionLeft += Vector2Up * (gGameParams.paddleSpeed * inputLeft * deltaTime);
-            gGameState.paddlePositionRight += Vector2Up * (gGameParams.paddleSpeed * inputRight * deltaTime);
-
-            gGameState.ballPosition += gGameState.ballVelocity * deltaTime;
-
-            // Check top wall
-            if (gGameState.ballPosition.Y + gGameParams.ballSize.Y > (gGameParams.gameSize.Y * 0.5f) - gGameParams.wallThickness)
-            {
-                gGameState.ballPosition.Y = ((gGameParams.gameSize.Y * 0.5f) - gGameParams.wallThickness) - gGameParams.ballSize.Y;
-                gGameState.ballVelocity.Y *= -1;
-            }
-            // Check bottom wall
-            else if (gGameState.ballPosition.Y < (-gGameParams.gameSize.Y * 0.5f) + gGameParams.wallThickness)
-            {
-                gGameState.ballPosition.Y = ((-gGameParams.gameSize.Y * 0.5f) + gGameParams.wallThickness);
-                gGameState.ballVelocity.Y *= -1;
-            }
+            postProcess.SetStageEnabled(PostStage::Crt, !postProcess.IsStageEnabled(PostStage::Crt));
+        }
+        if(hotkeys & (1u << HOTKEY_STATS))
+        {
+            const PostStageStats& bloom = postProcess.GetStats(PostStage::Bloom);
+            const PostStageStats& crt = postProcess.GetStats(PostStage::Crt);
+            char message[256];
+            SDL_snprintf(message, sizeof(message), "Post: bloom %.3fms %d passes %llu px, crt %.3fms %d passes %llu px",
+                bloom.cpuMilliseconds, bloom.passes, (unsigned long long)bloom.pixels,
+                crt.cpuMilliseconds, crt.passes, (unsigned long long)crt.pixels);
+            LOG(LOG_INFO, message);
+
+            TextLayoutStats text = renderContext.GetTextLayoutStats();
+            SDL_snprintf(message, sizeof(message), "Text layouts: %llu hits, %llu misses, %zu cached",
+                (unsigned long long)text.hits, (unsigned long long)text.misses, text.layouts);
+            LOG(LOG_INFO, message);
+
+            latency.LogSummary();
+        }
 
-            // Check Paddles
-            if (CheckCollisionRectangles(gGameState.paddlePositionLeft, gGameParams.paddleSize, gGameState.ballPosition, gGameParams.ballSize))
+        FrameCapture& capture = renderContext.GetCapture();
+        if(hotkeys & (1u << HOTKEY_CAPTURE))
+        {
+            if (capture.IsActive())
             {
-                gGameState.ballPosition.X = gGameState.paddlePositionLeft.X + gGameParams.paddleSize.X;
-                gGameState.ballVelocity.X *= -1;
+                capture.Stop();
+                CaptureStats stats = capture.GetStats();
+                char message[128];
+                SDL_snprintf(message, sizeof(message), "Capture stopped: %llu frames captured, %llu dropped",
+                    (unsigned long long)stats.captured, (unsigned long long)stats.dropped);
+                LOG(LOG_INFO, message);
             }
-            else if (CheckCollisionRectangles(gGameState.paddlePositionRight, gGameParams.paddleSize, gGameState.ballPosition, gGameParams.ballSize))
+            else
             {
-                gGameState.ballPosition.X = gGameState.paddlePositionRight.X - gGameParams.ballSize.X;
-                gGameState.ballVelocity.X *= -1;
+                // Hold shift for a PNG sequence instead of a Y4M stream
+                constexpr Input::KeySet shiftKeys = Input::MakeKeySet({SDL_SCANCODE_LSHIFT, SDL_SCANCODE_RSHIFT});
+                bool png = Input::IsAnyKeyDown(shiftKeys);
+                char path[64];
+                SDL_snprintf(path, sizeof(path), png ? "capture_%lld" : "capture_%lld.y4m", (long long)time(NULL));
+                int width, height;
+                SDL_GL_GetDrawableSize(sdl_window(), &width, &height);
+                capture.Start(path, png ? CaptureFormat::PngSequence : CaptureFormat::Y4M, width, height);
             }
+        }
 
-            if (gGameState.ballPosition.X > gGameParams.gameSize.X * 0.5f)
-            {
-                gGameState.scoreLeft += 1;
-
-                if (gGameState.scoreLeft >= 10)
-                {
-                    gGameState.state = PONG_END;
-                }
-                else
-                {
-                    gGameState.state = PONG_WAITING;
-                    ResetGameElements();
-                }
-            }
-            else if (gGameState.ballPosition.X < -gGameParams.gameSize.X * 0.5f - gGameParams.ballSize.X)
-            {
-                gGameState.scoreRight += 1;
+        // Frames can run faster than ticks, collect the input until a tick consumes it. A key is then
+        // applied for exactly as long as it was held, whichever frames it was held in
+        float keyLeft = Input::GetAxisAverage(SDL_SCANCODE_S, SDL_SCANCODE_W);
+        float keyRight = Input::GetAxisAverage(SDL_SCANCODE_DOWN, SDL_SCANCODE_UP);
+        uint32_t frameSpan = Input::GetFrameSpan();
+        keyHeldLeft += keyLeft * frameSpan;
+        keyHeldRight += keyRight * frameSpan;
+        keySpan += frameSpan;
+        gamepadHeldLeft += static_cast<float>(gamepadLeft * deltaTime);
+        gamepadHeldRight += static_cast<float>(gamepadRight * deltaTime);
+        gamepadSpan += deltaTime;
+        // Spans too short to measure fall back to this frame's input
+        if (keySpan > 0)
+        {
+            keyLeft = keyHeldLeft / keySpan;
+            keyRight = keyHeldRight / keySpan;
+        }
+        if (gamepadSpan > 0.0)
+        {
+            gamepadLeft = static_cast<float>(gamepadHeldLeft / gamepadSpan);
+            gamepadRight = static_cast<float>(gamepadHeldRight / gamepadSpan);
+        }
+        // Every tick run this frame sees the same input
+        float inputLeft = HMM_Clamp(-1.f, keyLeft + gamepadLeft, 1.f);
+        float inputRight = HMM_Clamp(-1.f, keyRight + gamepadRight, 1.f);
+        startPending = startPending || startPressed;
 
-                if (gGameState.scoreRight >= 10)
-                {
-                    gGameState.state = PONG_END;
-                }
-                else
-                {
-                    gGameState.state = PONG_WAITING;
-                    ResetGameElements();
-                }
-            }
+        tickAccumulator += deltaTime;
+        if (tickAccumulator > MaxTicksPerFrame * SimulationTickSeconds)
+        {
+            tickAccumulator = MaxTicksPerFrame * SimulationTickSeconds;
         }
-        else if (gGameState.state == PONG_END)
+        int ticksRun = 0;
+        while (tickAccumulator >= SimulationTickSeconds)
         {
-            if(Input::IsKeyJustPressed(SDL_SCANCODE_SPACE))
+            previousGameState = gGameState;
+            gGameState = Step(gGameState, {FixedFromFloat(inputLeft), FixedFromFloat(inputRight), startPending});
+            startPending = false;
+            tickAccumulator -= SimulationTickSeconds;
+            ticksRun++;
+
+            // Serves and restarts teleport the ball, don't draw it sliding back to the center
+            if (gGameState.state != previousGameState.state)
             {
-                gGameState.state = PONG_PLAYING;
-                ResetGameElements();
-
-                gGameState.scoreLeft = 0;
-                gGameState.scoreRight = 0;
+                previousGameState = gGameState;
             }
         }
-
+        GameDrawState drawState = InterpolateGameState(previousGameState, gGameState, static_cast<float>(tickAccumulator / SimulationTickSeconds));
+        // Events and input wait until a tick consumes them
+        if (ticksRun > 0)
+        {
+            keyHeldLeft = keyHeldRight = 0.f;
+            keySpan = 0;
+            gamepadHeldLeft = gamepadHeldRight = 0.f;
+            gamepadSpan = 0.0;
+            latency.MarkSimulated(SDL_GetPerformanceCounter());
+        }
 
         Camera2D camera{.zoom = {1.f, 1.f}};
-        FitGameArea(camera);
+        FitGameArea(camera, renderer.GetViewportSize());
 
+        renderContext.BeginFrame();
         renderer.BeginDrawing();
 
         renderer.BeginCamera(camera);
             // Draw paddles and ball
-            renderer.DrawRectangle(gGameState.paddlePositionLeft, gGameParams.paddleSize, gGameParams.paddleColor);
-            renderer.DrawRectangle(gGameState.paddlePositionRight, gGameParams.paddleSize, gGameParams.paddleColor);
-            renderer.DrawRectangle(gGameState.ballPosition, gGameParams.ballSize, gGameParams.ballColor);
-
-            // Draw Top and Bottom walls
-            Vector2 gameAreaSize = gGameParams.gameSize;
-            renderer.DrawRectangle({-gameAreaSize.X * 0.5f, gameAreaSize.Y * 0.5f}, {gameAreaSize.X, -gGameParams.wallThickness}, gGameParams.wallColor);
-            renderer.DrawRectangle({-gameAreaSize.X * 0.5f, -gameAreaSize.Y * 0.5f}, {gameAreaSize.X, gGameParams.wallThickness}, gGameParams.wallColor);
-            
-            // Draw line
-            float lineHeight = (gameAreaSize.Y - gGameParams.lineGap * (gGameParams.lineSegments - 1)) / gGameParams.lineSegments;
-            for (int i = 0; i < gGameParams.lineSegments; i++)
-            {
-                renderer.DrawRectangle({-gGameParams.lineThickness * 0.5f, -gGameParams.gameHeight * 0.5f + (lineHeight + gGameParams.lineGap) * i}, {gGameParams.lineThickness, lineHeight}, gGameParams.lineColor);
-            }
-            
-            DrawDigit(HMM_MIN(gGameState.scoreLeft, 9) , renderer, {2 * -gGameParams.scoreSize.X, (gGameParams.gameSize.Y * 0.5f) - (gGameParams.scoreSize.Y * 1.5f)}, gGameParams.scoreSize, gGameParams.scoreColor);
-            DrawDigit(HMM_MIN(gGameState.scoreRight, 9), renderer, {     gGameParams.scoreSize.X, (gGameParams.gameSize.Y * 0.5f) - (gGameParams.scoreSize.Y * 1.5f)}, gGameParams.scoreSize, gGameParams.scoreColor);
+            renderer.DrawRectangle(drawState.paddlePositionLeft, gGameParams.paddleSize, gGameParams.paddleColor);
+            renderer.DrawRectangle(drawState.paddlePositionRight, gGameParams.paddleSize, gGameParams.paddleColor);
+            renderer.DrawRectangle(drawState.ballPosition, gGameParams.ballSize, gGameParams.ballColor);
+
+            // Walls and the center line are retained in the sprite layer and emitted by BeginCamera
+
+            // The left score grows away from the center line to the left, the right one to the right
+            DrawNumber(gGameState.scoreLeft , renderer, {2 * -gGameParams.scoreSize.X, (gGameParams.gameSize.Y * 0.5f) - (gGameParams.scoreSize.Y * 1.5f)}, gGameParams.scoreSize, gGameParams.scoreColor, FontAlignment::Right);
+            DrawNumber(gGameState.scoreRight, renderer, {     gGameParams.scoreSize.X, (gGameParams.gameSize.Y * 0.5f) - (gGameParams.scoreSize.Y * 1.5f)}, gGameParams.scoreSize, gGameParams.scoreColor, FontAlignment::Left);
 
             if(gGameState.state == PONG_END)
             {
@@ -361,22 +639,42 @@ int SDL_main( int argc, char* args[] )
         renderer.EndCamera();
 
         renderer.BeginUI();
+            Vector2 uiSize = renderer.GetViewportSize();
             if (gGameState.state == PONG_WAITING)
             {
-                renderer.DrawText({sdl_width() * 0.5f, sdl_height() * 0.7f}, "Press SPACE to begin", gGameParams.lineColor, FontAlignment::Center);
+                renderer.DrawText({uiSize.X * 0.5f, uiSize.Y * 0.7f}, "Press SPACE to begin", gGameParams.lineColor, FontAlignment::Center);
             }
             else if (gGameState.state == PONG_END)
             {
-                renderer.DrawText({sdl_width() * 0.5f, sdl_height() * 0.5f}, "GAME OVER!", gGameParams.lineColor, FontAlignment::Center);
-                renderer.DrawText({sdl_width() * 0.5f, sdl_height() * 0.5f + 48.f}, "Press SPACE to restart", gGameParams.lineColor, FontAlignment::Center);
+                TextBatchEntry gameOverText[] = {
+                    {{uiSize.X * 0.5f, uiSize.Y * 0.5f}, "GAME OVER!", gGameParams.lineColor, FontAlignment::Center},
+                    {{uiSize.X * 0.5f, uiSize.Y * 0.5f + 48.f}, "Press SPACE to restart", gGameParams.lineColor, FontAlignment::Center},
+                };
+                renderer.DrawTextBatch(gameOverText, sizeof(gameOverText) / sizeof(gameOverText[0]));
+            }
+            if (showFrameTime)
+            {
+                renderer.SetFont(consoleFont);
+                renderer.DrawTextFormat({uiSize.X - 4.f, 20.f}, gGameParams.lineColor, FontAlignment::Right, "{:.1} fps {:.2} ms", 1.0 / deltaTime, deltaTime * 1000.0);
+                renderer.SetFont({.id = InvalidFont});
             }
+            console.Draw(renderer);
         renderer.EndUI();
 
         renderer.EndDrawing();
+        latency.MarkSubmitted(SDL_GetPerformanceCounter());
+        renderContext.EndFrame();
+        latency.MarkPresented(SDL_GetPerformanceCounter());
     }
 
-    // shutdown sokol_gfx and sdl
-    renderer.Shutdown();
+    latency.LogSummary();
+
+    // shutdown sokol_gfx and sdl. The poller and capture threads log through the console, stop them first
+    recorder.Stop();
+    gamepads.Stop();
+    Input::Shutdown();
+    renderContext.Shutdown();
+    console.Shutdown();
     sdl_terminate();
     return 0;
 }
@@ -0,0 +1,117 @@
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const char* path)
+{
+    Close();
+
+    HANDLE fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    file = fileHandle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        Close();
+        return false;
+    }
+
+    mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data != nullptr)
+    {
+        UnmapViewOfFile(data);
+    }
+    if (mapping != nullptr)
+    {
+        CloseHandle(mapping);
+    }
+    if (file != nullptr)
+    {
+        CloseHandle(file);
+    }
+    file = nullptr;
+    mapping = nullptr;
+    data = nullptr;
+    size = 0;
+}
+
+#else
+
+bool MappedFile::Open(const char* path)
+{
+    Close();
+
+    descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(descriptor, &info) != 0 || info.st_size == 0)
+    {
+        Close();
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (view == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+
+    data = static_cast<const uint8_t*>(view);
+    size = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+    }
+    descriptor = -1;
+    data = nullptr;
+    size = 0;
+}
+
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Read only memory mapping of a whole file, pages are only read from disk when touched
+class MappedFile
+{
+private:
+#ifdef _WIN32
+    void* file = nullptr;
+    void* mapping = nullptr;
+#else
+    int descriptor = -1;
+#endif
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { Close(); }
+
+    bool Open(const char* path);
+    void Close();
+
+    const uint8_t* GetData() const { return data; }
+    size_t GetSize() const { return size; }
+};
+
+#endif // MAPPED_FILE_HPP
@@ -5,6 +5,7 @@
 #define MATH_TYPES_H
 
 #include "HandmadeMath.h"
+#include <cstdint>
 
 typedef HMM_Vec2 Vector2;
 typedef HMM_Vec3 Vector3;
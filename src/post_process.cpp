@@ -0,0 +1,225 @@
+#include "post_process.hpp"
+#include "math_types.hpp"
+#include "sdl_glue.h"
+#include "gen/post.glsl.h"
+#include "SDL_timer.h"
+#include <cassert>
+
+#include "logging.h"
+
+static double ElapsedMilliseconds(Uint64 start)
+{
+    return (SDL_GetPerformanceCounter() - start) * 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+}
+
+void PostProcess::Initialize()
+{
+    sg_sampler_desc sampler_desc = {
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+    };
+    sampler = sg_make_sampler(sampler_desc);
+
+    // Pyramid levels have no depth buffer
+    sg_pipeline_desc downsample_desc = {
+        .shader = sg_make_shader(post_downsample_shader_desc(sg_query_backend())),
+        .depth = { .pixel_format = SG_PIXELFORMAT_NONE },
+        .label = "post-downsample",
+    };
+    downsamplePip = sg_make_pipeline(downsample_desc);
+
+    sg_pipeline_desc upsample_desc = {
+        .shader = sg_make_shader(post_upsample_shader_desc(sg_query_backend())),
+        .depth = { .pixel_format = SG_PIXELFORMAT_NONE },
+        .label = "post-upsample",
+    };
+    // Each upsampled level is accumulated on top of the one above it
+    upsample_desc.colors[0].blend = {
+        .enabled = true,
+        .src_factor_rgb = SG_BLENDFACTOR_ONE,
+        .dst_factor_rgb = SG_BLENDFACTOR_ONE,
+        .src_factor_alpha = SG_BLENDFACTOR_ONE,
+        .dst_factor_alpha = SG_BLENDFACTOR_ZERO,
+    };
+    upsamplePip = sg_make_pipeline(upsample_desc);
+
+    sg_pipeline_desc composite_desc = {
+        .shader = sg_make_shader(post_composite_shader_desc(sg_query_backend())),
+        .label = "post-composite",
+    };
+    compositePip = sg_make_pipeline(composite_desc);
+}
+
+void PostProcess::Shutdown()
+{
+    sg_destroy_pipeline(downsamplePip);
+    sg_destroy_pipeline(upsamplePip);
+    sg_destroy_pipeline(compositePip);
+    sg_destroy_sampler(sampler);
+}
+
+void PostProcess::SetStageEnabled(PostStage stage, bool enable)
+{
+    enabled[static_cast<int>(stage)] = enable;
+    if (!enable)
+    {
+        stats[static_cast<int>(stage)] = {};
+    }
+}
+
+bool PostProcess::IsStageEnabled(PostStage stage) const
+{
+    return enabled[static_cast<int>(stage)];
+}
+
+bool PostProcess::IsActive() const
+{
+    return IsStageEnabled(PostStage::Bloom) || IsStageEnabled(PostStage::Crt);
+}
+
+const PostStageStats& PostProcess::GetStats(PostStage stage) const
+{
+    return stats[static_cast<int>(stage)];
+}
+
+RenderTarget PostProcess::Bloom(const RenderTarget& scene, RenderTargetPool& pool)
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    PostStageStats& stageStats = stats[static_cast<int>(PostStage::Bloom)];
+    stageStats = {};
+
+    RenderTarget levels[MaxBloomLevels];
+    int levelCount = 0;
+
+    sg_pass_action overwrite = {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }},
+    };
+
+    // Downsample, starting at half resolution and stopping once the levels get tiny
+    RenderTarget source = scene;
+    for (int i = 0; i < MaxBloomLevels; i++)
+    {
+        int width = scene.width >> (i + 1);
+        int height = scene.height >> (i + 1);
+        if (width < 8 || height < 8)
+        {
+            if (i > 0)
+            {
+                break;
+            }
+            width = HMM_MAX(width, 1);
+            height = HMM_MAX(height, 1);
+        }
+
+        levels[i] = pool.Acquire(width, height, false);
+        levelCount++;
+
+        sg_begin_pass({ .action = overwrite, .attachments = levels[i].attachments, .label = "bloom-downsample" });
+        sg_apply_pipeline(downsamplePip);
+        sg_bindings bind = {};
+        bind.images[IMG__post_source] = source.color;
+        bind.samplers[SMP_post_smp] = sampler;
+        sg_apply_bindings(bind);
+        post_downsample_params_t params = {
+            .texel_size = {1.f / source.width, 1.f / source.height},
+            .threshold = bloomThreshold,
+            // Only the first level thresholds the scene
+            .knee = i == 0 ? HMM_MAX(bloomKnee, 0.0001f) : 0.f,
+        };
+        sg_apply_uniforms(UB_post_downsample_params, SG_RANGE(params));
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+
+        stageStats.pixels += static_cast<uint64_t>(width) * height;
+        stageStats.passes++;
+        source = levels[i];
+    }
+
+    // Upsample back up, adding every level into the one above
+    sg_pass_action accumulate = {
+        .colors = {{ .load_action = SG_LOADACTION_LOAD }},
+    };
+    for (int i = levelCount - 1; i > 0; i--)
+    {
+        RenderTarget& target = levels[i - 1];
+        sg_begin_pass({ .action = accumulate, .attachments = target.attachments, .label = "bloom-upsample" });
+        sg_apply_pipeline(upsamplePip);
+        sg_bindings bind = {};
+        bind.images[IMG__post_source] = levels[i].color;
+        bind.samplers[SMP_post_smp] = sampler;
+        sg_apply_bindings(bind);
+        post_upsample_params_t params = {
+            .texel_size = {1.f / levels[i].width, 1.f / levels[i].height},
+            .radius = 1.f,
+            .intensity = 1.f,
+        };
+        sg_apply_uniforms(UB_post_upsample_params, SG_RANGE(params));
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+
+        // The level is not needed anymore, the next stage can reuse it
+        pool.Release(levels[i]);
+
+        stageStats.pixels += static_cast<uint64_t>(target.width) * target.height;
+        stageStats.passes++;
+    }
+
+    stageStats.cpuMilliseconds = ElapsedMilliseconds(start);
+    return levels[0];
+}
+
+void PostProcess::Apply(const RenderTarget& scene, RenderTargetPool& pool)
+{
+    bool bloom = IsStageEnabled(PostStage::Bloom);
+    bool crt = IsStageEnabled(PostStage::Crt);
+    assert((bloom || crt) && "Post processing applied without any active stage");
+
+    RenderTarget bloomTarget = {};
+    if (bloom)
+    {
+        bloomTarget = Bloom(scene, pool);
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+
+    sg_pass_action overwrite = {
+        .colors = {{ .load_action = SG_LOADACTION_DONTCARE }},
+        .depth = { .load_action = SG_LOADACTION_DONTCARE },
+    };
+    sg_begin_pass({ .action = overwrite, .swapchain = sdl_swapchain(), .label = "post-composite" });
+    sg_apply_pipeline(compositePip);
+    sg_bindings bind = {};
+    bind.images[IMG__post_scene] = scene.color;
+    // Without bloom the scene is bound twice and the bloom term is weighted out
+    bind.images[IMG__post_bloom] = bloom ? bloomTarget.color : scene.color;
+    bind.samplers[SMP_post_smp] = sampler;
+    sg_apply_bindings(bind);
+    post_composite_params_t params = {
+        .resolution = {static_cast<float>(scene.width), static_cast<float>(scene.height)},
+        .bloom_intensity = bloom ? bloomIntensity : 0.f,
+        .crt_enabled = crt ? 1.f : 0.f,
+        .scanline_strength = scanlineStrength,
+        .vignette_strength = vignetteStrength,
+        .curvature = curvature,
+    };
+    sg_apply_uniforms(UB_post_composite_params, SG_RANGE(params));
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+
+    if (bloom)
+    {
+        pool.Release(bloomTarget);
+    }
+
+    // The composite is attributed to the CRT stage when it runs, otherwise it is the tail of the bloom
+    PostStageStats& compositeStats = stats[static_cast<int>(crt ? PostStage::Crt : PostStage::Bloom)];
+    if (crt)
+    {
+        compositeStats = {};
+    }
+    compositeStats.cpuMilliseconds += ElapsedMilliseconds(start);
+    compositeStats.pixels += static_cast<uint64_t>(scene.width) * scene.height;
+    compositeStats.passes++;
+}
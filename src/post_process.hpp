@@ -0,0 +1,62 @@
+#pragma once
+#ifndef POST_PROCESS_HPP
+#define POST_PROCESS_HPP
+
+#include "sokol_gfx.h"
+#include "render_target_pool.hpp"
+
+enum class PostStage{
+    Bloom,
+    Crt,
+    Count,
+};
+
+struct PostStageStats{
+    // CPU time spent encoding the stage's passes, sokol does not expose GPU timers
+    double cpuMilliseconds;
+    // Pixels shaded by the stage, a backend independent measure of its fill cost
+    uint64_t pixels;
+    int passes;
+};
+
+// Runs after the main pass: a half resolution downsample pyramid feeds the bloom,
+// and a final composite pass applies the CRT look while writing to the swapchain.
+// All intermediate targets come from the shared RenderTargetPool.
+class PostProcess
+{
+private:
+    static constexpr int MaxBloomLevels = 5;
+
+    sg_pipeline downsamplePip;
+    sg_pipeline upsamplePip;
+    sg_pipeline compositePip;
+    sg_sampler sampler;
+
+    // Off by default, F3/F4 or the bloom and crt commands turn them on
+    bool enabled[static_cast<int>(PostStage::Count)] = {false, false};
+    PostStageStats stats[static_cast<int>(PostStage::Count)];
+
+    RenderTarget Bloom(const RenderTarget& scene, RenderTargetPool& pool);
+public:
+    float bloomThreshold = 0.6f;
+    float bloomKnee = 0.2f;
+    float bloomIntensity = 0.8f;
+    float scanlineStrength = 0.25f;
+    float vignetteStrength = 0.6f;
+    float curvature = 0.04f;
+
+    void Initialize();
+    void Shutdown();
+
+    void SetStageEnabled(PostStage stage, bool enable);
+    bool IsStageEnabled(PostStage stage) const;
+    // When no stage is enabled the main pass goes straight to the swapchain
+    bool IsActive() const;
+
+    const PostStageStats& GetStats(PostStage stage) const;
+
+    // Consumes the scene target and writes the final image into the swapchain
+    void Apply(const RenderTarget& scene, RenderTargetPool& pool);
+};
+
+#endif // POST_PROCESS_HPP
@@ -0,0 +1,325 @@
+#include "render_context.hpp"
+#include "sdl_glue.h"
+#include "gen/quad_uv.glsl.h"
+#include <cassert>
+#include <cstring>
+
+#include "logging.h"
+
+#define SOKOL_IMPL
+#define SOKOL_GLCORE
+#include "sokol_gfx.h"
+#include "sokol_log.h"
+
+// Used by the PNG sequence capture
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "stb_rect_pack.h"
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "stb_truetype.h"
+
+void RenderContext::Initialize()
+{
+    sg_desc desc = {
+        // Room for the pooled post processing targets, see RenderTargetPool::MaxTargets
+        .attachments_pool_size = 32,
+        .logger = {.func = log_func},
+        .environment = sdl_environment(),
+    };
+    sg_setup(&desc);
+    assert(sg_isvalid());
+
+    // default pass action, clear to black
+    pass_action = {
+        .colors = {{ .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } } }
+    };
+
+    frameQuads = static_cast<Quad*>(SDL_malloc(sizeof(Quad) * MaxFrameQuads));
+    assert(frameQuads != nullptr);
+    transforms.reserve(MaxTransforms * 4);
+    quadRuns.reserve(64);
+
+    sg_buffer_desc vertex_buffer_desc = {
+        .size = sizeof(Quad) * MaxFrameQuads,
+        .usage = sg_usage::SG_USAGE_STREAM,
+    };
+
+	// make the vertex buffer
+	bind.vertex_buffers[0] = sg_make_buffer(&vertex_buffer_desc);
+
+
+	{ // make & fill the index buffer
+        constexpr size_t index_buffer_count = MaxQuadsPerDraw * 6;
+        static uint16_t indices[index_buffer_count];
+        for (size_t i = 0; i < index_buffer_count; i+=6) {
+            // vertex offset pattern to draw a quad
+            // { 0, 1, 2,  0, 2, 3 }
+            indices[i + 0] = static_cast<uint16_t>((i/6)*4 + 0);
+            indices[i + 1] = static_cast<uint16_t>((i/6)*4 + 1);
+            indices[i + 2] = static_cast<uint16_t>((i/6)*4 + 2);
+            indices[i + 3] = static_cast<uint16_t>((i/6)*4 + 0);
+            indices[i + 4] = static_cast<uint16_t>((i/6)*4 + 2);
+            indices[i + 5] = static_cast<uint16_t>((i/6)*4 + 3);
+        }
+
+        sg_buffer_desc index_buffer_desc = {
+            .type = sg_buffer_type::SG_BUFFERTYPE_INDEXBUFFER,
+            .data = { .ptr = indices, .size = sizeof(indices) },
+        };
+        bind.index_buffer = sg_make_buffer(index_buffer_desc);
+    }
+
+    // setup pipeline
+	sg_pipeline_desc pipeline_desc = {
+		.shader = sg_make_shader(quad_uv_shader_desc(sg_query_backend())),
+		.layout = {
+			.attrs = {
+				[ATTR_quad_uv_position] = { .format = sg_vertex_format::SG_VERTEXFORMAT_FLOAT3 },
+				[ATTR_quad_uv_color0] = { .format = sg_vertex_format::SG_VERTEXFORMAT_FLOAT4 },
+				[ATTR_quad_uv_bytes0] = { .format = sg_vertex_format::SG_VERTEXFORMAT_UBYTE4N },
+				[ATTR_quad_uv_texcoord0] = { .format = sg_vertex_format::SG_VERTEXFORMAT_FLOAT2 },
+			},
+		},
+        .depth = {
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+		.index_type = sg_index_type::SG_INDEXTYPE_UINT16,
+        // .cull_mode = SG_CULLMODE_BACK,
+	};
+
+    // Linear filtering lets distance field glyphs scale smoothly, pixel aligned coverage glyphs sample texel centers either way
+    sg_sampler_desc sampler_desc = {
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .wrap_u = SG_WRAP_CLAMP_TO_EDGE,
+        .wrap_v = SG_WRAP_CLAMP_TO_EDGE,
+    };
+	bind.samplers[SMP_texture0_smp] = sg_make_sampler(sampler_desc);
+
+    glyphCache.Initialize();
+
+
+	sg_blend_state blend_state = {
+		.enabled = true,
+		.src_factor_rgb = sg_blend_factor::SG_BLENDFACTOR_SRC_ALPHA,
+		.dst_factor_rgb = sg_blend_factor::SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+		.op_rgb = sg_blend_op::SG_BLENDOP_ADD,
+		.src_factor_alpha = sg_blend_factor::SG_BLENDFACTOR_ONE,
+		.dst_factor_alpha = sg_blend_factor::SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+		.op_alpha = sg_blend_op::SG_BLENDOP_ADD,
+	};
+	pipeline_desc.colors[0] = { .blend = blend_state };
+	pip = sg_make_pipeline(pipeline_desc);
+
+    postProcess.Initialize();
+}
+
+void RenderContext::Shutdown()
+{
+    SDL_free(frameQuads);
+    frameQuads = nullptr;
+
+    capture.Shutdown();
+    textLayouts.Clear();
+    glyphCache.Shutdown();
+    postProcess.Shutdown();
+    targetPool.Shutdown();
+    sg_shutdown();
+}
+
+Font RenderContext::LoadFont(const char *path, float fontSize, FontMode mode /* = FontMode::Coverage */, const char* bakedPath /* = nullptr */)
+{
+    // Glyphs are rasterized into the shared atlas the first time they are drawn
+    FontId id = glyphCache.FindFont(path, mode);
+    if (id == InvalidFont)
+    {
+        id = bakedPath != nullptr ? glyphCache.LoadBakedFont(bakedPath, path, mode) : glyphCache.LoadFont(path, mode);
+    }
+    if (id == InvalidFont)
+    {
+        return {.id = InvalidFont};
+    }
+
+    // Without a bake the printable ASCII range of the first size is packed up front, anything else is rasterized when drawn
+    if (mode == FontMode::Coverage && !glyphCache.HasPinnedGlyphs(id))
+    {
+        constexpr CodepointRange ascii = {.first = 32, .count = 95};
+        glyphCache.PackFont(id, static_cast<int>(fontSize), &ascii, 1);
+    }
+
+    Font font = {.id = id, .pixelHeight = static_cast<int>(fontSize)};
+    if (defaultFont.id == InvalidFont)
+    {
+        defaultFont = font;
+    }
+    return font;
+}
+
+bool RenderContext::ReloadFont(Font font, const char* path)
+{
+    assert(font.id != InvalidFont);
+    if (!glyphCache.ReloadFont(font.id, path, glyphCache.GetMode(font.id)))
+    {
+        return false;
+    }
+    textLayouts.Clear();
+    return true;
+}
+
+const TextLayout& RenderContext::GetTextLayout(Font font, const char* text, FontAlignment alignment)
+{
+    assert(font.id != InvalidFont && "You can't lay out text before loading a font!");
+    return textLayouts.Get(glyphCache, font, text, alignment);
+}
+
+void RenderContext::SetClearColor(Color color)
+{
+    pass_action.colors->clear_value = {color.R, color.G, color.B, color.A};
+}
+
+void RenderContext::BeginFrame()
+{
+    frameQuadCount = 0;
+    transforms.clear();
+    paletteSegment = 0;
+    quadRuns.clear();
+}
+
+uint8_t RenderContext::PushTransform(const Matrix& transform, const Vector4& clip, uint32_t* segment)
+{
+    assert(segment != nullptr);
+    // HMM matrices are column major, Elements[column][row]
+    PaletteTransform entry = {
+        .row0 = {transform.Elements[0][0], transform.Elements[1][0], transform.Elements[3][0], transform.Elements[2][2]},
+        .row1 = {transform.Elements[0][1], transform.Elements[1][1], transform.Elements[3][1], transform.Elements[3][2]},
+        .clip = {clip.X, clip.Y, clip.Z, clip.W},
+    };
+
+    size_t segmentStart = paletteSegment * MaxTransforms;
+    for (size_t i = segmentStart; i < transforms.size(); i++)
+    {
+        if (memcmp(&transforms[i], &entry, sizeof(entry)) == 0)
+        {
+            *segment = paletteSegment;
+            return static_cast<uint8_t>(i - segmentStart);
+        }
+    }
+
+    // Never hand out a slot of another transform, start a new segment instead
+    if (transforms.size() - segmentStart == MaxTransforms)
+    {
+        paletteSegment++;
+        segmentStart += MaxTransforms;
+    }
+
+    transforms.push_back(entry);
+    *segment = paletteSegment;
+    return static_cast<uint8_t>(transforms.size() - 1 - segmentStart);
+}
+
+void RenderContext::Submit(const Quad* quads, size_t count, uint32_t segment)
+{
+    assert(segment <= paletteSegment);
+    if (frameQuadCount + count > MaxFrameQuads)
+    {
+        LOG(LOG_WARNING, "Frame quad budget exceeded, dropping quads");
+        count = MaxFrameQuads - frameQuadCount;
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (!quadRuns.empty() && quadRuns.back().segment == segment)
+    {
+        quadRuns.back().count += count;
+    }
+    else
+    {
+        quadRuns.push_back({.first = frameQuadCount, .count = count, .segment = segment});
+    }
+
+    memcpy(frameQuads + frameQuadCount, quads, sizeof(Quad) * count);
+    frameQuadCount += count;
+}
+
+void RenderContext::EndFrame()
+{
+    glyphCache.Flush();
+    // The atlas image changes when it grows
+    bind.images[IMG__texture0] = glyphCache.GetImage();
+
+    if (frameQuadCount > 0)
+    {
+        sg_update_buffer(
+            bind.vertex_buffers[0],
+            { .ptr = frameQuads, .size = sizeof(Quad) * frameQuadCount }
+        );
+    }
+
+    // With post processing the main pass goes into a pooled target that matches the swapchain
+    bool postActive = postProcess.IsActive();
+    RenderTarget scene = {};
+    sg_pass pass = { .action = pass_action };
+    if (postActive)
+    {
+        sg_swapchain swapchain = sdl_swapchain();
+        scene = targetPool.Acquire(swapchain.width, swapchain.height, true);
+        pass.attachments = scene.attachments;
+    }
+    else
+    {
+        pass.swapchain = sdl_swapchain();
+    }
+    sg_begin_pass(&pass);
+    sg_apply_pipeline(pip);
+
+    // Each palette segment is uploaded once, so cameras, UI layers and viewports don't split the batch.
+    // Every renderer's viewport lives in its palette transforms, so each run is drawn in index buffer
+    // sized chunks regardless of how many renderers submitted. Only a new segment costs another upload
+    static_assert(sizeof(vs_params_t::transforms) == sizeof(PaletteTransform) * MaxTransforms);
+    uint32_t appliedSegment = UINT32_MAX;
+    for (const QuadRun& run : quadRuns)
+    {
+        if (run.segment != appliedSegment)
+        {
+            vs_params_t vs_params;
+            size_t segmentStart = run.segment * MaxTransforms;
+            size_t entries = HMM_MIN(transforms.size() - segmentStart, MaxTransforms);
+            memcpy(vs_params.transforms, transforms.data() + segmentStart, sizeof(PaletteTransform) * entries);
+            sg_apply_uniforms(UB_vs_params, SG_RANGE(vs_params));
+            appliedSegment = run.segment;
+        }
+
+        for (size_t first = run.first; first < run.first + run.count; first += MaxQuadsPerDraw)
+        {
+            size_t count = HMM_MIN(run.first + run.count - first, MaxQuadsPerDraw);
+            bind.vertex_buffer_offsets[0] = static_cast<int>(first * sizeof(Quad));
+            sg_apply_bindings(bind);
+            sg_draw(0, 6*count, 1);
+        }
+    }
+
+    sg_end_pass();
+
+    if (postActive)
+    {
+        postProcess.Apply(scene, targetPool);
+        targetPool.Release(scene);
+    }
+
+    sg_commit();
+    targetPool.EndFrame();
+    textLayouts.EndFrame();
+
+    // The composite or main pass left the swapchain bound, queue its readback before presenting
+    int width, height;
+    SDL_GL_GetDrawableSize(sdl_window(), &width, &height);
+    capture.CaptureFrame(width, height);
+
+    SDL_GL_SwapWindow(sdl_window());
+}
@@ -0,0 +1,114 @@
+#pragma once
+#ifndef RENDER_CONTEXT_HPP
+#define RENDER_CONTEXT_HPP
+
+#include "sokol_gfx.h"
+#include "math_types.hpp"
+#include "glyph_cache.hpp"
+#include "text_layout_cache.hpp"
+#include "render_target_pool.hpp"
+#include "post_process.hpp"
+#include "frame_capture.hpp"
+#include <vector>
+
+// Quads are drawn with 16 bit indices so one draw can reach at most 65536 vertices
+constexpr size_t MaxQuadsPerDraw = 65536 / 4;
+constexpr size_t MaxFrameQuads = MaxQuadsPerDraw * 2;
+// Size of one transform palette segment, matches vs_params in quad_uv.glsl
+constexpr size_t MaxTransforms = 64;
+
+#pragma pack(push, 1)
+struct Vertex{
+    Vector3 position;
+    Color color;
+    uint8_t textureIndex;
+    uint8_t transformIndex;
+    uint8_t _padding[2];
+    Vector2 uv;
+};
+
+struct Quad{
+    Vertex vertices[4];
+};
+#pragma pack(pop)
+
+// Quad positions are in the space of the renderer that recorded them, every vertex
+// names one of these and the vertex shader applies it. Only the x/y rows of the
+// orthographic matrices are stored, plus the depth scale and offset in .w.
+// Fragments outside clip, the window clip space rect of the renderer's viewport, are discarded
+struct PaletteTransform{
+    float row0[4];
+    float row1[4];
+    // min x, min y, max x, max y
+    float clip[4];
+};
+
+// Consecutive frame quads drawn with the same palette segment
+struct QuadRun{
+    size_t first;
+    size_t count;
+    uint32_t segment;
+};
+
+// Owns the sokol_gfx context and every GPU resource shared between renderers.
+// Renderers record their quads independently and submit them here, the whole
+// frame is then uploaded once and drawn with as few draw calls as possible.
+class RenderContext
+{
+private:
+    Quad* frameQuads = nullptr;
+    size_t frameQuadCount = 0;
+
+    // Segments of MaxTransforms entries each, the last one is being filled. When it is full the next
+    // transform starts a new segment, quads drawn with different segments go out in separate draws
+    std::vector<PaletteTransform> transforms;
+    uint32_t paletteSegment = 0;
+    std::vector<QuadRun> quadRuns;
+
+    sg_pass_action pass_action;
+    sg_pipeline pip;
+    sg_bindings bind;
+
+    // First font loaded, used by renderers that never picked one
+    Font defaultFont = {.id = InvalidFont};
+    GlyphCache glyphCache;
+    TextLayoutCache textLayouts;
+
+    RenderTargetPool targetPool;
+    PostProcess postProcess;
+    FrameCapture capture;
+public:
+
+    void Initialize();
+    void Shutdown();
+
+    // Returns a handle for the font at fontSize, id is InvalidFont on failure. Every font and size lives in
+    // the same glyph atlas, so text in any mix of them still goes out in one draw call. Loading a path
+    // again in the same mode shares the ttf and its atlas pages, only the size in the handle differs.
+    // With a baked font path the glyphs in the bake are ready without reading the ttf, see tools/font_baker.cpp
+    Font LoadFont(const char* path, float fontSize, FontMode mode = FontMode::Coverage, const char* bakedPath = nullptr);
+    // Replaces the ttf behind a handle, which drops its glyphs and every cached layout
+    bool ReloadFont(Font font, const char* path);
+    bool HasFont() const { return defaultFont.id != InvalidFont; }
+    const Font& GetDefaultFont() const { return defaultFont; }
+    GlyphCache& GetGlyphCache() { return glyphCache; }
+    const TextLayout& GetTextLayout(Font font, const char* text, FontAlignment alignment);
+    TextLayoutStats GetTextLayoutStats() const { return textLayouts.GetStats(); }
+
+    void SetClearColor(Color color);
+
+    PostProcess& GetPostProcess() { return postProcess; }
+    const RenderTargetPool& GetTargetPool() const { return targetPool; }
+    FrameCapture& GetCapture() { return capture; }
+
+    void BeginFrame();
+    // Adds a clip space transform and the clip space rect it may draw into to this frame's palette and returns
+    // its index for Vertex::transformIndex, segment receives the palette segment the index belongs to.
+    // Identical entries in the current segment are shared so renderers can push freely whenever their camera changes
+    uint8_t PushTransform(const Matrix& transform, const Vector4& clip, uint32_t* segment);
+    // Quads have to be submitted with the segment of the transform indices they use
+    void Submit(const Quad* quads, size_t count, uint32_t segment);
+    void EndFrame();
+};
+
+#endif // RENDER_CONTEXT_HPP
@@ -0,0 +1,107 @@
+#include "render_target_pool.hpp"
+#include <cassert>
+
+#include "logging.h"
+
+static void DestroyTarget(const RenderTarget& target)
+{
+    sg_destroy_attachments(target.attachments);
+    sg_destroy_image(target.color);
+    if (target.depth.id != SG_INVALID_ID)
+    {
+        sg_destroy_image(target.depth);
+    }
+}
+
+void RenderTargetPool::Shutdown()
+{
+    for (const Entry& entry : entries)
+    {
+        DestroyTarget(entry.target);
+    }
+    entries.clear();
+}
+
+RenderTarget RenderTargetPool::Acquire(int width, int height, bool withDepth)
+{
+    for (Entry& entry : entries)
+    {
+        if (!entry.inUse && entry.hasDepth == withDepth && entry.target.width == width && entry.target.height == height)
+        {
+            entry.inUse = true;
+            entry.lastUsedFrame = frame;
+            return entry.target;
+        }
+    }
+
+    RenderTarget target{.width = width, .height = height};
+
+    sg_image_desc color_desc = {
+        .render_target = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .sample_count = 1,
+        .label = "pooled-color-target",
+    };
+    target.color = sg_make_image(color_desc);
+
+    sg_attachments_desc attachments_desc = {
+        .colors = {{ .image = target.color }},
+    };
+
+    if (withDepth)
+    {
+        sg_image_desc depth_desc = {
+            .render_target = true,
+            .width = width,
+            .height = height,
+            .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+            .sample_count = 1,
+            .label = "pooled-depth-target",
+        };
+        target.depth = sg_make_image(depth_desc);
+        attachments_desc.depth_stencil.image = target.depth;
+    }
+
+    target.attachments = sg_make_attachments(attachments_desc);
+
+    entries.push_back({.target = target, .hasDepth = withDepth, .inUse = true, .lastUsedFrame = frame});
+    DEBUG_LOG("Allocated pooled render target");
+    return target;
+}
+
+void RenderTargetPool::Release(const RenderTarget& target)
+{
+    for (Entry& entry : entries)
+    {
+        if (entry.target.attachments.id == target.attachments.id)
+        {
+            assert(entry.inUse && "Render target released twice");
+            entry.inUse = false;
+            return;
+        }
+    }
+    assert(false && "Render target does not belong to this pool");
+}
+
+void RenderTargetPool::EndFrame()
+{
+    for (size_t i = 0; i < entries.size();)
+    {
+        Entry& entry = entries[i];
+        assert(!entry.inUse && "Render target was not released before the end of the frame");
+        bool stale = frame - entry.lastUsedFrame > MaxIdleFrames;
+        bool overBudget = entries.size() > MaxTargets && entry.lastUsedFrame != frame;
+        if (stale || overBudget)
+        {
+            DestroyTarget(entry.target);
+            entries[i] = entries.back();
+            entries.pop_back();
+            continue;
+        }
+        i++;
+    }
+
+    frame++;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#ifndef RENDER_TARGET_POOL_HPP
+#define RENDER_TARGET_POOL_HPP
+
+#include "sokol_gfx.h"
+#include <vector>
+
+struct RenderTarget{
+    sg_image color;
+    sg_image depth;
+    sg_attachments attachments;
+    int width;
+    int height;
+};
+
+// Hands out offscreen color (+ optional depth) targets for the duration of a pass chain.
+// Released targets go back to the pool and are reused by later passes in the same frame
+// and by following frames, targets nobody asked for in a while are destroyed.
+class RenderTargetPool
+{
+private:
+    struct Entry{
+        RenderTarget target;
+        bool hasDepth;
+        bool inUse;
+        uint32_t lastUsedFrame;
+    };
+
+    std::vector<Entry> entries;
+    uint32_t frame = 0;
+public:
+    // Frames an unused target survives before it is destroyed
+    static constexpr uint32_t MaxIdleFrames = 60;
+    // Past this many targets anything not used this frame is destroyed right away, covers window resizes
+    static constexpr size_t MaxTargets = 16;
+
+    void Shutdown();
+
+    RenderTarget Acquire(int width, int height, bool withDepth);
+    void Release(const RenderTarget& target);
+    void EndFrame();
+
+    size_t GetTargetCount() const { return entries.size(); }
+};
+
+#endif // RENDER_TARGET_POOL_HPP
@@ -1,223 +1,162 @@
 #include "renderer.hpp"
 #include "sdl_glue.h"
-#include "gen/quad_uv.glsl.h"
 #include <cassert>
 
 #include "logging.h"
 
-#define SOKOL_IMPL
-#define SOKOL_GLCORE
-#include "sokol_gfx.h"
-#include "sokol_log.h"
-
-
-#ifdef _DEBUG
-    #define STB_IMAGE_WRITE_IMPLEMENTATION
-    #include "stb_image_write.h"
-#endif
-
-#define STB_RECT_PACK_IMPLEMENTATION
-#include "stb_rect_pack.h"
-#define STB_TRUETYPE_IMPLEMENTATION
-#include "stb_truetype.h"
-
-void Renderer::Initialize()
+void Renderer::Initialize(RenderContext* context)
 {
-    sg_desc desc = {
-        .logger = {.func = slog_func},
-        .environment = sdl_environment(),
-    };
-    sg_setup(&desc);
-    assert(sg_isvalid());
-
-    // default pass action, clear to black
-    pass_action = {
-        .colors = {{ .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } } }
-    };
-
-
-    sg_buffer_desc vertex_buffer_desc = {
-        .size = sizeof(Quad) * MaxQuads,
-        .usage = sg_usage::SG_USAGE_DYNAMIC,
-    };
-    
-	// make the vertex buffer
-	bind.vertex_buffers[0] = sg_make_buffer(&vertex_buffer_desc);
-
-    
-	{ // make & fill the index buffer
-        constexpr size_t index_buffer_count = MaxQuads * 6;
-        uint16_t indices[index_buffer_count];
-        for (size_t i = 0; i < index_buffer_count; i+=6) {
-            // vertex offset pattern to draw a quad
-            // { 0, 1, 2,  0, 2, 3 }
-            indices[i + 0] = static_cast<uint16_t>((i/6)*4 + 0);
-            indices[i + 1] = static_cast<uint16_t>((i/6)*4 + 1);
-            indices[i + 2] = static_cast<uint16_t>((i/6)*4 + 2);
-            indices[i + 3] = static_cast<uint16_t>((i/6)*4 + 0);
-            indices[i + 4] = static_cast<uint16_t>((i/6)*4 + 2);
-            indices[i + 5] = static_cast<uint16_t>((i/6)*4 + 3);
-        }
-
-        sg_buffer_desc index_buffer_desc = {
-            .type = sg_buffer_type::SG_BUFFERTYPE_INDEXBUFFER,
-            .data = { .ptr = indices, .size = sizeof(indices) },
-        };
-        bind.index_buffer = sg_make_buffer(index_buffer_desc);
-    }
-
-    // setup pipeline
-	sg_pipeline_desc pipeline_desc = {
-		.shader = sg_make_shader(quad_uv_shader_desc(sg_query_backend())),
-		.layout = {
-			.attrs = {
-				[ATTR_quad_uv_position] = { .format = sg_vertex_format::SG_VERTEXFORMAT_FLOAT3 },
-				[ATTR_quad_uv_color0] = { .format = sg_vertex_format::SG_VERTEXFORMAT_FLOAT4 },
-				[ATTR_quad_uv_bytes0] = { .format = sg_vertex_format::SG_VERTEXFORMAT_BYTE4N },
-				[ATTR_quad_uv_texcoord0] = { .format = sg_vertex_format::SG_VERTEXFORMAT_FLOAT2 },
-			},
-		},
-        .depth = {
-            .compare = SG_COMPAREFUNC_LESS_EQUAL,
-            .write_enabled = true,
-        },
-		.index_type = sg_index_type::SG_INDEXTYPE_UINT16,
-        // .cull_mode = SG_CULLMODE_BACK,
-	};
-
-    sg_sampler_desc sampler_desc = {0};
-	bind.samplers[SMP_texture0_smp] = sg_make_sampler(sampler_desc);
-
-
-	sg_blend_state blend_state = {
-		.enabled = true,
-		.src_factor_rgb = sg_blend_factor::SG_BLENDFACTOR_SRC_ALPHA,
-		.dst_factor_rgb = sg_blend_factor::SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-		.op_rgb = sg_blend_op::SG_BLENDOP_ADD,
-		.src_factor_alpha = sg_blend_factor::SG_BLENDFACTOR_ONE,
-		.dst_factor_alpha = sg_blend_factor::SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-		.op_alpha = sg_blend_op::SG_BLENDOP_ADD,
-	};
-	pipeline_desc.colors[0] = { .blend = blend_state };
-	pip = sg_make_pipeline(pipeline_desc);
+    assert(context != nullptr);
+    this->context = context;
+    draw_list.reserve(MaxQuadsPerDraw / 16);
 }
 
-void Renderer::Shutdown()
+void Renderer::SetViewport(Viewport viewport)
 {
-    sg_shutdown();
+    this->viewport = viewport;
 }
 
-void Renderer::LoadFont(const char *path, float fontSize)
+Vector2 Renderer::GetViewportSize() const
 {
-    static unsigned char temp_bitmap[1024*1024];
-    
-    void* fontFile = SDL_LoadFile(path, NULL);
-    if (fontFile == NULL)
+    if (viewport.width <= 0 || viewport.height <= 0)
     {
-        LOG(LOG_ERROR, "Could not open font file");
-        SDL_ClearError();
-        return; 
+        return {static_cast<float>(sdl_width()), static_cast<float>(sdl_height())};
     }
+    return {static_cast<float>(viewport.width), static_cast<float>(viewport.height)};
+}
 
-    int result = stbtt_BakeFontBitmap((unsigned char*)fontFile, 0, fontSize, temp_bitmap, 1024, 1024, 32, 96, fontChars);
-    SDL_free(fontFile);
-    assert(result > 0 && "Could not fit font into temporary bitmap!");
-
-#ifdef _DEBUG
-    stbi_write_png("font.png", 1024, 1024, 1, temp_bitmap, 0);
-#endif
+Matrix Renderer::WorldProjection() const
+{
+    Vector2 size = GetViewportSize();
+    return viewportTransform * HMM_Orthographic_RH_NO(-size.X / 2.f, size.X / 2.0f, -size.Y / 2.f, size.Y / 2.0f, -100.f, 100.f);
+}
 
-    sg_image_desc font_image_desc {
-        .type = SG_IMAGETYPE_2D,
-        .width = 1024,
-        .height = 1024,
-        .pixel_format = SG_PIXELFORMAT_R8,
-        .data = { .subimage = {{{.ptr = temp_bitmap, .size = 1024 * 1024}}}}
-    };
+Font Renderer::CurrentFont() const
+{
+    return font.id != InvalidFont ? font : context->GetDefaultFont();
+}
 
-    sg_image image = sg_make_image(font_image_desc);
-    if (image.id == SG_INVALID_ID)
+void Renderer::UpdateTransform()
+{
+    uint32_t segment;
+    uint8_t index = context->PushTransform(projection * view, viewportClip, &segment);
+    // The context ran out of palette room and started a new segment, the quads recorded
+    // so far index the old one and go out with it
+    if (segment != transformSegment && !draw_list.empty())
     {
-        // TODO: Soft error
-        assert("Could not load image data");
-        return;
+        context->Submit(draw_list.data(), draw_list.size(), transformSegment);
+        draw_list.clear();
     }
-
-    bind.images[IMG__texture0] = image;
-
-    hasFont = true;
-
+    transformIndex = index;
+    transformSegment = segment;
 }
 
 void Renderer::BeginDrawing()
 {
-    draw_frame.count = 0;
-    projection = HMM_Orthographic_RH_NO(-sdl_width() / 2.f, sdl_width() / 2.0f, -sdl_height() / 2.f, sdl_height() / 2.0f, -100.f, 100.f);
+    draw_list.clear();
+
+    // Squash the full clip space into the viewport's slice of the window clip space
+    Vector2 windowSize = {static_cast<float>(sdl_width()), static_cast<float>(sdl_height())};
+    Vector2 size = GetViewportSize();
+    Vector2 scale = {size.X / windowSize.X, size.Y / windowSize.Y};
+    Vector2 offset = {
+        (2.f * viewport.x + size.X) / windowSize.X - 1.f,
+        1.f - (2.f * viewport.y + size.Y) / windowSize.Y,
+    };
+    viewportTransform = HMM_Translate({offset.X, offset.Y, 0}) * HMM_Scale({scale.X, scale.Y, 1.f});
+    viewportClip = {offset.X - scale.X, offset.Y - scale.Y, offset.X + scale.X, offset.Y + scale.Y};
+
+    projection = WorldProjection();
     view = HMM_M4D(1.f);
+    UpdateTransform();
 }
 
 void Renderer::EndDrawing()
 {
-    sg_update_buffer(
-        bind.vertex_buffers[0],
-        { .ptr = draw_frame.quads, .size = sizeof(Quad) * MaxQuads }
-    );
-    sg_pass pass = { .action = pass_action, .swapchain = sdl_swapchain() };
-    sg_begin_pass(&pass);
-    sg_apply_pipeline(pip);
-    sg_apply_bindings(bind);
-    sg_draw(0, 6*draw_frame.count, 1);
-    sg_end_pass();
-    sg_commit();
-
-    SDL_GL_SwapWindow(sdl_window());
+    context->Submit(draw_list.data(), draw_list.size(), transformSegment);
 }
 
 void Renderer::BeginCamera(Camera2D camera)
 {
     Matrix cameraMat = HMM_Scale({camera.zoom.X, camera.zoom.Y, 0}) * HMM_Translate({-camera.position.X, -camera.position.Y, 0});
-    view = cameraMat;    
+    view = cameraMat;
+    UpdateTransform();
+
+    if (spriteLayer != nullptr)
+    {
+        // The projection spans the drawable size centered on the origin, undo the zoom to get world units
+        Vector2 size = GetViewportSize();
+        Vector2 halfExtents = {size.X * 0.5f / HMM_ABS(camera.zoom.X), size.Y * 0.5f / HMM_ABS(camera.zoom.Y)};
+
+        visibleSprites.clear();
+        spriteLayer->Query(camera.position - halfExtents, camera.position + halfExtents, visibleSprites);
+        for (SpriteId id : visibleSprites)
+        {
+            const Sprite& sprite = spriteLayer->Get(id);
+            DrawRectangle(sprite.position, sprite.size, sprite.color, sprite.texture, sprite.uv, sprite.depth);
+        }
+    }
 }
 
 void Renderer::EndCamera()
 {
     view = HMM_M4D(1.0f);
+    UpdateTransform();
 }
 
 void Renderer::BeginUI()
 {
-    projection = HMM_Orthographic_RH_NO(0, sdl_width(), sdl_height(), 0, -100.f, 100.f);
+    Vector2 size = GetViewportSize();
+    projection = viewportTransform * HMM_Orthographic_RH_NO(0, size.X, size.Y, 0, -100.f, 100.f);
     view = HMM_M4D(1.0f);
+    UpdateTransform();
 }
 
 void Renderer::EndUI()
 {
-    projection = HMM_Orthographic_RH_NO(-sdl_width() / 2.f, sdl_width() / 2.0f, -sdl_height() / 2.f, sdl_height() / 2.0f, -100.f, 100.f);
+    projection = WorldProjection();
     view = HMM_M4D(1.0f);
+    UpdateTransform();
 }
 
-void Renderer::SetClearColor(Color color)
+void Renderer::SetSpriteLayer(SpriteLayer* layer)
 {
-    pass_action.colors->clear_value = {color.R, color.G, color.B, color.A};
+    spriteLayer = layer;
 }
 
-void Renderer::DrawRectangle(Vector2 position, Vector2 size, Color color, uint8_t texture /* = UINT8_MAX */, Vector4 uv /* = {0, 0, 1, 1}  */, float depth /* = 0 */)
+void Renderer::SetFont(Font font)
 {
-    assert(draw_frame.count != MaxQuads && "Ran out of space for more quads");
-
-    Matrix mvp = projection * view;
+    this->font = font;
+}
 
-    Vector3 top_left     = HMM_MulM4V4(mvp, {position.X, position.Y, depth, 1.f}).XYZ;
-    Vector3 bottom_left  = HMM_MulM4V4(mvp, {position.X, position.Y + size.Y, depth, 1.f}).XYZ;
-    Vector3 bottom_right = HMM_MulM4V4(mvp, {position.X + size.X, position.Y + size.Y, depth, 1.f}).XYZ;
-    Vector3 top_right    = HMM_MulM4V4(mvp, {position.X + size.X, position.Y, depth, 1.f}).XYZ;
+void Renderer::DrawRectangle(Vector2 position, Vector2 size, Color color, uint8_t texture /* = UINT8_MAX */, Vector4 uv /* = {0, 0, 1, 1}  */, float depth /* = 0 */)
+{
+    // Positions stay in world/UI space, the vertex shader applies the palette transform
+    Vector3 top_left     = {position.X, position.Y, depth};
+    Vector3 bottom_left  = {position.X, position.Y + size.Y, depth};
+    Vector3 bottom_right = {position.X + size.X, position.Y + size.Y, depth};
+    Vector3 top_right    = {position.X + size.X, position.Y, depth};
+
+    draw_list.push_back({{
+        {top_left    , color, texture, transformIndex, {}, {uv[0], uv[1]}},
+        {bottom_left , color, texture, transformIndex, {}, {uv[0], uv[3]}},
+        {bottom_right, color, texture, transformIndex, {}, {uv[2], uv[3]}},
+        {top_right   , color, texture, transformIndex, {}, {uv[2], uv[1]}},
+    }});
+}
 
-    draw_frame.quads[draw_frame.count++] = {{
-        {top_left    , color, texture, {}, {uv[0], uv[1]}},
-        {bottom_left , color, texture, {}, {uv[0], uv[3]}},
-        {bottom_right, color, texture, {}, {uv[2], uv[3]}},
-        {top_right   , color, texture, {}, {uv[2], uv[1]}},
-    }};
+static inline void WriteGlyphQuad(Quad& quad, float x, float y, const LayoutGlyph& glyph, Color color, uint8_t transformIndex)
+{
+    float x0 = x + glyph.offset.X;
+    float y0 = y + glyph.offset.Y;
+    float x1 = x0 + glyph.size.X;
+    float y1 = y0 + glyph.size.Y;
+
+    Vertex* vertices = quad.vertices;
+    vertices[0] = {{x0, y0, 0}, color, glyph.texture, transformIndex, {}, {glyph.uv[0], glyph.uv[1]}};
+    vertices[1] = {{x0, y1, 0}, color, glyph.texture, transformIndex, {}, {glyph.uv[0], glyph.uv[3]}};
+    vertices[2] = {{x1, y1, 0}, color, glyph.texture, transformIndex, {}, {glyph.uv[2], glyph.uv[3]}};
+    vertices[3] = {{x1, y0, 0}, color, glyph.texture, transformIndex, {}, {glyph.uv[2], glyph.uv[1]}};
 }
 
 #ifdef DrawText
@@ -225,66 +164,187 @@ void Renderer::DrawRectangle(Vector2 position, Vector2 size, Color color, uint8_
 #endif
 void Renderer::DrawText(Vector2 position, const char *text, Color color, FontAlignment horizontalAlignment)
 {
-    assert(hasFont && "You can't draw text before loading a font!");
+    TextBatchEntry entry = {position, text, color, horizontalAlignment};
+    DrawTextBatch(&entry, 1);
+}
 
-    // Make sure the quads are pixel aligned
-    position = {roundf(position.X), roundf(position.Y)};
+void Renderer::DrawTextBatch(const TextBatchEntry* entries, size_t count)
+{
+    assert(context->HasFont() && "You can't draw text before loading a font!");
+
+    // Repeated strings come straight out of the layout cache, only the translation changes.
+    // All fonts share the glyph atlas, so mixing them doesn't split the draw
+    Font current = CurrentFont();
+    batchLayouts.resize(count);
+    size_t glyphCount = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        Font entryFont = entries[i].font.id != InvalidFont ? entries[i].font : current;
+        batchLayouts[i] = &context->GetTextLayout(entryFont, entries[i].text, entries[i].alignment);
+        glyphCount += batchLayouts[i]->glyphs.size();
+    }
+
+    // One resize for the whole batch, then plain stores into the new quads
+    size_t first = draw_list.size();
+    draw_list.resize(first + glyphCount);
+    Quad* quad = draw_list.data() + first;
 
-    float textWidth = MeasureText(text);
+    for (size_t i = 0; i < count; i++)
+    {
+        // Make sure the quads are pixel aligned
+        float x = roundf(entries[i].position.X);
+        float y = roundf(entries[i].position.Y);
+        Color color = entries[i].color;
 
-    float advance = 0.f;
+        for (const LayoutGlyph& glyph : batchLayouts[i]->glyphs)
+        {
+            WriteGlyphQuad(*quad, x, y, glyph, color, transformIndex);
+            quad++;
+        }
+    }
+}
 
-    for (int i = 0; text[i] != '\0'; i++)
+// Writes the digits of value backwards from end, returns where they start
+static char* FormatUnsigned(uint64_t value, char* end)
+{
+    do
     {
-        char next = text[i];
-        FontChar fontChar =  fontChars[next - 32];
+        *--end = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    return end;
+}
+
+void Renderer::DrawFormattedText(Vector2 position, Color color, FontAlignment alignment, const char* format,
+                                 const FormatSegment* segments, int segmentCount, const FormatArg* args)
+{
+    assert(context->HasFont() && "You can't draw text before loading a font!");
 
-        
-        Vector4 uv;
-        uv[0] = fontChar.x0 / 1024.f;
-        uv[1] = fontChar.y0 / 1024.f;
-        uv[2] = fontChar.x1 / 1024.f;
-        uv[3] = fontChar.y1 / 1024.f;
+    // Make sure the quads are pixel aligned
+    float x = roundf(position.X);
+    float y = roundf(position.Y);
 
-        Vector2 size = {fontChar.x1 - fontChar.x0, fontChar.y1 - fontChar.y0};
+    GlyphPlacer placer(context->GetGlyphCache(), CurrentFont());
+    size_t first = draw_list.size();
+    auto placeText = [&](const char* text, const char* end) {
+        while (text < end && *text != '\0')
+        {
+            LayoutGlyph glyph;
+            if (placer.Place(DecodeUTF8(text), glyph) == GlyphPlacement::Placed)
+            {
+                draw_list.emplace_back();
+                WriteGlyphQuad(draw_list.back(), x, y, glyph, color, transformIndex);
+            }
+        }
+    };
 
-        Vector2 currentPosition = position;
-        currentPosition += Vector2{advance + fontChar.xoff, fontChar.yoff};
+    constexpr uint64_t powersOf10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+    for (int i = 0; i < segmentCount; i++)
+    {
+        const FormatSegment& segment = segments[i];
+        if (segment.argIndex < 0)
+        {
+            placeText(format + segment.begin, format + segment.begin + segment.length);
+            continue;
+        }
 
-        switch (horizontalAlignment)
+        // Digits are produced right to left into a few bytes of stack and placed from there
+        char digits[48];
+        char* end = digits + sizeof(digits);
+        char* start = end;
+        const FormatArg& arg = args[segment.argIndex];
+        switch (arg.kind)
         {
-        case FontAlignment::Left:
+        case FormatArgKind::Signed:
+            start = FormatUnsigned(arg.i < 0 ? 0 - static_cast<uint64_t>(arg.i) : static_cast<uint64_t>(arg.i), end);
+            if (arg.i < 0)
+            {
+                *--start = '-';
+            }
             break;
-        case FontAlignment::Center:
-            currentPosition.X -= textWidth * 0.5f;
+        case FormatArgKind::Unsigned:
+            start = FormatUnsigned(arg.u, end);
             break;
-        case FontAlignment::Right:
-            currentPosition.X -= textWidth;
+        case FormatArgKind::Float:
+        {
+            double value = arg.f;
+            if (value != value)
+            {
+                start = end - 3;
+                start[0] = 'n'; start[1] = 'a'; start[2] = 'n';
+                break;
+            }
+            bool negative = value < 0;
+            value = negative ? -value : value;
+
+            uint64_t scale = powersOf10[segment.precision];
+            // Past this the fixed point value doesn't fit, show it like an overflow
+            if (value * scale >= 1.8e19)
+            {
+                start = end - 3;
+                start[0] = 'i'; start[1] = 'n'; start[2] = 'f';
+            }
+            else
+            {
+                uint64_t fixed = static_cast<uint64_t>(value * scale + 0.5);
+                if (segment.precision > 0)
+                {
+                    char* fraction = FormatUnsigned(fixed % scale, end);
+                    while (end - fraction < segment.precision)
+                    {
+                        *--fraction = '0';
+                    }
+                    *--fraction = '.';
+                    start = FormatUnsigned(fixed / scale, fraction);
+                }
+                else
+                {
+                    start = FormatUnsigned(fixed, end);
+                }
+                negative = negative && fixed > 0;
+            }
+            if (negative)
+            {
+                *--start = '-';
+            }
             break;
-        default:
-            assert(true && "Invalid text alignment value");
+        }
+        case FormatArgKind::String:
+            placeText(arg.s, arg.s + SDL_strlen(arg.s));
             break;
         }
+        placeText(start, end);
+    }
 
-        advance += fontChar.xadvance;
-
-        DrawRectangle(currentPosition, size, color, 0, uv);
+    float shift = 0.f;
+    if (alignment == FontAlignment::Center)
+    {
+        shift = -placer.GetAdvance() * 0.5f;
+    }
+    else if (alignment == FontAlignment::Right)
+    {
+        shift = -placer.GetAdvance();
+    }
+    if (shift != 0.f)
+    {
+        for (size_t i = first; i < draw_list.size(); i++)
+        {
+            for (Vertex& vertex : draw_list[i].vertices)
+            {
+                vertex.position.X += shift;
+            }
+        }
     }
-    
 }
 
 float Renderer::MeasureText(const char *text)
 {
-    assert(hasFont && "You can't measure text before loading a font!");
-
-    float advance = 0.f;
-
-    for (int i = 0; text[i] != '\0'; i++)
-    {
-        char next = text[i];
-        FontChar fontChar =  fontChars[next - 32];
-        advance += fontChar.xadvance;
-    }
+    assert(context->HasFont() && "You can't measure text before loading a font!");
+    return context->GetTextLayout(CurrentFont(), text, FontAlignment::Left).width;
+}
 
-    return advance;
+float Renderer::GetLineHeight() const
+{
+    assert(context->HasFont() && "You can't measure text before loading a font!");
+    return static_cast<float>(CurrentFont().pixelHeight);
 }
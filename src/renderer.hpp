@@ -2,30 +2,19 @@
 #ifndef RENDERER_HPP
 #define RENDERER_HPP
 
-#include "sokol_gfx.h"
-#include "math_types.hpp"
-#include "stb_truetype.h"
+#include "render_context.hpp"
+#include "sprite_layer.hpp"
+#include "text_format.hpp"
+#include <type_traits>
+#include <vector>
 
-constexpr size_t MaxQuads = 1024;
-
-#pragma pack(push, 1)
-struct Vertex{
-    Vector3 position;
+struct TextBatchEntry{
+    Vector2 position;
+    const char* text;
     Color color;
-    uint8_t textureIndex;
-    uint8_t _padding[3];
-    Vector2 uv;
-};
-
-struct Quad{
-    Vertex vertices[4];
-};
-#pragma pack(pop)
-
-struct DrawFrame
-{
-    Quad quads[MaxQuads];
-    size_t count;
+    FontAlignment alignment;
+    // InvalidFont draws with the renderer's current font
+    Font font = {.id = InvalidFont};
 };
 
 struct Camera2D{
@@ -33,38 +22,52 @@ struct Camera2D{
     Vector2 zoom;
 };
 
-typedef stbtt_bakedchar FontChar;
-
-struct Font{
-    FontChar chars[128];
-};
-
-enum class FontAlignment{
-    Left,
-    Center,
-    Right,
+// Region of the window a renderer draws into, in drawable pixels from the top left.
+// A zero width or height means the whole window.
+struct Viewport{
+    int x, y;
+    int width, height;
 };
 
 class Renderer
 {
 private:
-    DrawFrame draw_frame{0};
+    RenderContext* context = nullptr;
+    std::vector<Quad> draw_list;
 
-	sg_pass_action pass_action;
-    sg_pipeline pip;
-    sg_bindings bind;
+    Viewport viewport{0};
+    // Maps this renderer's clip space into the part of the window covered by the viewport
+    Matrix viewportTransform;
+    // The viewport in window clip space as min x, min y, max x, max y, nothing is drawn outside it
+    Vector4 viewportClip;
 
     Matrix projection;
     Matrix view;
+    // Palette entry for projection * view, refreshed whenever either changes
+    uint8_t transformIndex = 0;
+    // Palette segment transformIndex belongs to, every quad in draw_list uses this segment
+    uint32_t transformSegment = 0;
+
+    // InvalidFont until SetFont, which means the context's default font
+    Font font = {.id = InvalidFont};
 
-    bool hasFont = false;
-    FontChar fontChars[128];
+    SpriteLayer* spriteLayer = nullptr;
+    std::vector<SpriteId> visibleSprites;
+
+    // Layouts of the entries of the current DrawTextBatch call
+    std::vector<const TextLayout*> batchLayouts;
+
+    Matrix WorldProjection() const;
+    Font CurrentFont() const;
+    void DrawFormattedText(Vector2 position, Color color, FontAlignment alignment, const char* format,
+                           const FormatSegment* segments, int segmentCount, const FormatArg* args);
+    void UpdateTransform();
 public:
 
-    void Initialize();
-    void Shutdown();
+    void Initialize(RenderContext* context);
 
-    void LoadFont(const char* path, float fontSize);
+    void SetViewport(Viewport viewport);
+    Vector2 GetViewportSize() const;
 
     void BeginDrawing();
     void EndDrawing();
@@ -75,13 +78,29 @@ public:
     void BeginUI();
     void EndUI();
 
-    void SetClearColor(Color color);
+    // Sprites in the layer are culled against the camera and emitted by BeginCamera
+    void SetSpriteLayer(SpriteLayer* layer);
+
+    // Font used by DrawText, MeasureText and batch entries without their own font
+    void SetFont(Font font);
 
     void DrawRectangle(Vector2 position, Vector2 size, Color color, uint8_t texture = UINT8_MAX, Vector4 uv = {0, 0, 1, 1}, float depth = 0);
     void DrawText(Vector2 position, const char* text, Color color, FontAlignment horizontalAlignment = FontAlignment::Left);
+    // Lays out all entries first, then writes every glyph quad straight into the draw list in one pass
+    void DrawTextBatch(const TextBatchEntry* entries, size_t count);
+    // Draws a format string like "{} fps" with its arguments, see text_format.hpp. The format is parsed
+    // at compile time and numbers go straight to glyph quads, nothing is allocated or cached
+    template<typename... Args>
+    void DrawTextFormat(Vector2 position, Color color, FontAlignment alignment, TextFormat<std::type_identity_t<Args>...> format, const Args&... args)
+    {
+        const FormatArg packed[sizeof...(Args) + 1] = {MakeFormatArg(args)...};
+        DrawFormattedText(position, color, alignment, format.text, format.segments, format.segmentCount, packed);
+    }
     float MeasureText(const char* text);
+    // Pixel height of the current font, the distance between two lines of text
+    float GetLineHeight() const;
 };
 
 
 
-#endif // RENDERER_HPP
\ No newline at end of file
+#endif // RENDERER_HPP
@@ -32,8 +32,8 @@ bool sdl_init(const sdl_desc_t* desc) {
     _minor_version = desc_def.version_minor;
 
 
-    /* First, initialize SDL's video subsystem. */
-    if( SDL_Init( SDL_INIT_VIDEO ) < 0 ) {
+    /* First, initialize SDL's video and game controller subsystems. */
+    if( SDL_Init( SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER ) < 0 ) {
         /* Failed, exit. */
         printf("Video initialization failed: %s\n", SDL_GetError( ) );
         return false;
@@ -0,0 +1,195 @@
+#include "simulation.hpp"
+
+static uint32_t NextRandom(uint32_t& rngState)
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// gGameParams in simulation units, converted once at compile time
+constexpr FixedVector2 PaddleSize = FixedVector2FromVector2(gGameParams.paddleSize);
+constexpr FixedVector2 BallSize = FixedVector2FromVector2(gGameParams.ballSize);
+constexpr Fixed HalfGameWidth = FixedFromFloat(gGameParams.gameSize.X * 0.5f);
+constexpr Fixed HalfGameHeight = FixedFromFloat(gGameParams.gameSize.Y * 0.5f);
+constexpr Fixed WallThickness = FixedFromFloat(gGameParams.wallThickness);
+constexpr FixedVector2 PaddleStartLeft = {FixedFromFloat(-gGameParams.gameSize.X * 0.45f - gGameParams.paddleSize.X * 0.5f), FixedFromFloat(gGameParams.paddleSize.Y * -0.5f)};
+constexpr FixedVector2 PaddleStartRight = {FixedFromFloat(gGameParams.gameSize.X * 0.45f - gGameParams.paddleSize.X * 0.5f), FixedFromFloat(gGameParams.paddleSize.Y * -0.5f)};
+constexpr FixedVector2 BallStart = {FixedFromFloat(gGameParams.ballSize.X * -0.5f), FixedFromFloat(gGameParams.ballSize.Y * -0.5f)};
+// Distance a paddle at full input covers in one tick
+constexpr Fixed PaddleStep = FixedFromFloat(gGameParams.paddleSpeed * SimulationTickSeconds);
+
+// Serves leave at one of these angles within 45 degrees of the horizontal, picked by random bits
+constexpr int ServeDirectionBits = 6;
+constexpr int ServeDirectionCount = 1 << ServeDirectionBits;
+
+// Taylor series for |x| <= pi/4, only ever evaluated by the compiler to fill the serve table
+constexpr double TableSin(double x)
+{
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 10; i++)
+    {
+        term *= -x * x / ((2 * i) * (2 * i + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr double TableCos(double x)
+{
+    double term = 1.0;
+    double sum = 1.0;
+    for (int i = 1; i < 10; i++)
+    {
+        term *= -x * x / ((2 * i - 1) * (2 * i));
+        sum += term;
+    }
+    return sum;
+}
+
+struct ServeTable{
+    // Ball velocity towards the right in units per tick, serves to the left negate it
+    FixedVector2 velocities[ServeDirectionCount];
+};
+
+constexpr ServeTable BuildServeTable()
+{
+    ServeTable table = {};
+    double ballStep = gGameParams.ballSpeed * SimulationTickSeconds;
+    for (int i = 0; i < ServeDirectionCount; i++)
+    {
+        // Centers of ServeDirectionCount equal slices of -45 to 45 degrees
+        double angle = (-0.25 + (i + 0.5) / (2.0 * ServeDirectionCount)) * HMM_PI;
+        table.velocities[i] = {FixedFromFloat(ballStep * TableCos(angle)), FixedFromFloat(ballStep * TableSin(angle))};
+    }
+    return table;
+}
+
+constexpr ServeTable ServeVelocities = BuildServeTable();
+
+// Centers the paddles and serves the ball in a random direction
+static void ResetGameElements(GameState& game)
+{
+    game.paddlePositionLeft = PaddleStartLeft;
+    game.paddlePositionRight = PaddleStartRight;
+
+    game.ballPosition = BallStart;
+    // Top bit picks the side, the next ServeDirectionBits the angle
+    uint32_t random = NextRandom(game.rngState);
+    FixedVector2 velocity = ServeVelocities.velocities[(random >> (31 - ServeDirectionBits)) & (ServeDirectionCount - 1)];
+    if (random & 0x80000000u)
+    {
+        velocity = {-velocity.X, -velocity.Y};
+    }
+    game.ballVelocity = velocity;
+}
+
+bool CheckCollisionRectangles(FixedVector2 position1, FixedVector2 size1, FixedVector2 position2, FixedVector2 size2)
+{
+    return ((position1.X < (position2.X + size2.X) && (position1.X + size1.X) > position2.X) &&
+        (position1.Y < (position2.Y + size2.Y) && (position1.Y + size1.Y) > position2.Y));
+}
+
+GameState NewGame(uint32_t seed)
+{
+    GameState game = {};
+    game.state = PONG_WAITING;
+    // Spread nearby seeds apart, xorshift needs a few rounds to forget similar starting states
+    game.rngState = seed * 0x9E3779B9u;
+    if (game.rngState == 0)
+    {
+        game.rngState = 0x9E3779B9u;
+    }
+    ResetGameElements(game);
+    return game;
+}
+
+GameState Step(const GameState& current, const GameInputs& inputs)
+{
+    GameState game = current;
+    const bool startPressed = inputs.start;
+
+    if (game.state == PONG_WAITING)
+    {
+        if(startPressed)
+        {
+            game.state = PONG_PLAYING;
+        }
+    }
+    else if (game.state == PONG_PLAYING)
+    {
+        game.paddlePositionLeft.Y += FixedMul(PaddleStep, FixedClamp(-FixedOne, inputs.left, FixedOne));
+        game.paddlePositionRight.Y += FixedMul(PaddleStep, FixedClamp(-FixedOne, inputs.right, FixedOne));
+
+        game.ballPosition += game.ballVelocity;
+
+        // Check top wall
+        if (game.ballPosition.Y + BallSize.Y > HalfGameHeight - WallThickness)
+        {
+            game.ballPosition.Y = (HalfGameHeight - WallThickness) - BallSize.Y;
+            game.ballVelocity.Y = -game.ballVelocity.Y;
+        }
+        // Check bottom wall
+        else if (game.ballPosition.Y < -HalfGameHeight + WallThickness)
+        {
+            game.ballPosition.Y = -HalfGameHeight + WallThickness;
+            game.ballVelocity.Y = -game.ballVelocity.Y;
+        }
+
+        // Check Paddles
+        if (CheckCollisionRectangles(game.paddlePositionLeft, PaddleSize, game.ballPosition, BallSize))
+        {
+            game.ballPosition.X = game.paddlePositionLeft.X + PaddleSize.X;
+            game.ballVelocity.X = -game.ballVelocity.X;
+        }
+        else if (CheckCollisionRectangles(game.paddlePositionRight, PaddleSize, game.ballPosition, BallSize))
+        {
+            game.ballPosition.X = game.paddlePositionRight.X - BallSize.X;
+            game.ballVelocity.X = -game.ballVelocity.X;
+        }
+
+        if (game.ballPosition.X > HalfGameWidth)
+        {
+            game.scoreLeft += 1;
+
+            if (game.scoreLeft >= 10)
+            {
+                game.state = PONG_END;
+            }
+            else
+            {
+                game.state = PONG_WAITING;
+                ResetGameElements(game);
+            }
+        }
+        else if (game.ballPosition.X < -HalfGameWidth - BallSize.X)
+        {
+            game.scoreRight += 1;
+
+            if (game.scoreRight >= 10)
+            {
+                game.state = PONG_END;
+            }
+            else
+            {
+                game.state = PONG_WAITING;
+                ResetGameElements(game);
+            }
+        }
+    }
+    else if (game.state == PONG_END)
+    {
+        if(startPressed)
+        {
+            game.state = PONG_PLAYING;
+            ResetGameElements(game);
+
+            game.scoreLeft = 0;
+            game.scoreRight = 0;
+        }
+    }
+
+    return game;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include "game_state.hpp"
+
+// Game rules, free of SDL and rendering so the game and the headless simulator share them.
+// Everything is a function of the GameState passed in, the same state and inputs always give the same result
+
+// Waiting for the first serve, the seed picks the serve directions of the whole game
+GameState NewGame(uint32_t seed);
+// The state one tick of SimulationTickSeconds later
+GameState Step(const GameState& game, const GameInputs& inputs);
+
+bool CheckCollisionRectangles(FixedVector2 position1, FixedVector2 size1, FixedVector2 position2, FixedVector2 size2);
+
+#endif // SIMULATION_HPP
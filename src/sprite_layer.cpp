@@ -0,0 +1,176 @@
+#include "sprite_layer.hpp"
+#include <algorithm>
+#include <cassert>
+
+void SpriteLayer::Initialize(Vector2 worldMin, Vector2 worldSize, float cellSize)
+{
+    assert(cellSize > 0 && "Sprite layer cell size must be positive");
+
+    origin = worldMin;
+    this->cellSize = cellSize;
+    cellsX = HMM_MAX(1, static_cast<int>(ceilf(worldSize.X / cellSize)));
+    cellsY = HMM_MAX(1, static_cast<int>(ceilf(worldSize.Y / cellSize)));
+
+    Clear();
+}
+
+void SpriteLayer::Clear()
+{
+    entries.clear();
+    freeIds.clear();
+    cells.assign(cellsX * cellsY, {});
+    queryStamp = 0;
+}
+
+void SpriteLayer::GetCellRange(const Sprite& sprite, int& minX, int& minY, int& maxX, int& maxY) const
+{
+    // Sizes may be negative, normalize to a min/max box first
+    float x0 = HMM_MIN(sprite.position.X, sprite.position.X + sprite.size.X);
+    float x1 = HMM_MAX(sprite.position.X, sprite.position.X + sprite.size.X);
+    float y0 = HMM_MIN(sprite.position.Y, sprite.position.Y + sprite.size.Y);
+    float y1 = HMM_MAX(sprite.position.Y, sprite.position.Y + sprite.size.Y);
+
+    minX = std::clamp(static_cast<int>(floorf((x0 - origin.X) / cellSize)), 0, cellsX - 1);
+    maxX = std::clamp(static_cast<int>(floorf((x1 - origin.X) / cellSize)), 0, cellsX - 1);
+    minY = std::clamp(static_cast<int>(floorf((y0 - origin.Y) / cellSize)), 0, cellsY - 1);
+    maxY = std::clamp(static_cast<int>(floorf((y1 - origin.Y) / cellSize)), 0, cellsY - 1);
+}
+
+void SpriteLayer::Link(SpriteId id)
+{
+    Entry& entry = entries[id];
+    GetCellRange(entry.sprite, entry.cellMinX, entry.cellMinY, entry.cellMaxX, entry.cellMaxY);
+    for (int y = entry.cellMinY; y <= entry.cellMaxY; y++)
+    {
+        for (int x = entry.cellMinX; x <= entry.cellMaxX; x++)
+        {
+            cells[y * cellsX + x].push_back(id);
+        }
+    }
+}
+
+void SpriteLayer::Unlink(SpriteId id)
+{
+    Entry& entry = entries[id];
+    for (int y = entry.cellMinY; y <= entry.cellMaxY; y++)
+    {
+        for (int x = entry.cellMinX; x <= entry.cellMaxX; x++)
+        {
+            std::vector<SpriteId>& cell = cells[y * cellsX + x];
+            auto it = std::find(cell.begin(), cell.end(), id);
+            assert(it != cell.end() && "Sprite is missing from its grid cell");
+            // Order inside a cell does not matter, queries sort their results
+            *it = cell.back();
+            cell.pop_back();
+        }
+    }
+}
+
+SpriteId SpriteLayer::Add(const Sprite& sprite)
+{
+    SpriteId id;
+    if (!freeIds.empty())
+    {
+        id = freeIds.back();
+        freeIds.pop_back();
+    }
+    else
+    {
+        id = static_cast<SpriteId>(entries.size());
+        entries.push_back({});
+    }
+
+    entries[id] = {.sprite = sprite, .queryStamp = queryStamp, .alive = true};
+    Link(id);
+    return id;
+}
+
+void SpriteLayer::Update(SpriteId id, const Sprite& sprite)
+{
+    assert(id < entries.size() && entries[id].alive && "Invalid sprite id");
+
+    Entry& entry = entries[id];
+    int minX, minY, maxX, maxY;
+    GetCellRange(sprite, minX, minY, maxX, maxY);
+    if (minX == entry.cellMinX && minY == entry.cellMinY && maxX == entry.cellMaxX && maxY == entry.cellMaxY)
+    {
+        // Still covers the same cells, no need to touch the grid
+        entry.sprite = sprite;
+        return;
+    }
+
+    Unlink(id);
+    entry.sprite = sprite;
+    Link(id);
+}
+
+void SpriteLayer::Remove(SpriteId id)
+{
+    assert(id < entries.size() && entries[id].alive && "Invalid sprite id");
+
+    Unlink(id);
+    entries[id].alive = false;
+    freeIds.push_back(id);
+}
+
+const Sprite& SpriteLayer::Get(SpriteId id) const
+{
+    assert(id < entries.size() && entries[id].alive && "Invalid sprite id");
+    return entries[id].sprite;
+}
+
+void SpriteLayer::Query(Vector2 min, Vector2 max, std::vector<SpriteId>& out)
+{
+    if (cells.empty())
+    {
+        return;
+    }
+
+    // Sprites spanning several cells are only reported once per query
+    queryStamp++;
+    if (queryStamp == 0)
+    {
+        for (Entry& entry : entries)
+        {
+            entry.queryStamp = 0;
+        }
+        queryStamp = 1;
+    }
+
+    int minX = std::clamp(static_cast<int>(floorf((min.X - origin.X) / cellSize)), 0, cellsX - 1);
+    int maxX = std::clamp(static_cast<int>(floorf((max.X - origin.X) / cellSize)), 0, cellsX - 1);
+    int minY = std::clamp(static_cast<int>(floorf((min.Y - origin.Y) / cellSize)), 0, cellsY - 1);
+    int maxY = std::clamp(static_cast<int>(floorf((max.Y - origin.Y) / cellSize)), 0, cellsY - 1);
+
+    size_t first = out.size();
+    for (int y = minY; y <= maxY; y++)
+    {
+        for (int x = minX; x <= maxX; x++)
+        {
+            for (SpriteId id : cells[y * cellsX + x])
+            {
+                Entry& entry = entries[id];
+                if (entry.queryStamp == queryStamp)
+                {
+                    continue;
+                }
+                entry.queryStamp = queryStamp;
+
+                const Sprite& sprite = entry.sprite;
+                float x0 = HMM_MIN(sprite.position.X, sprite.position.X + sprite.size.X);
+                float x1 = HMM_MAX(sprite.position.X, sprite.position.X + sprite.size.X);
+                float y0 = HMM_MIN(sprite.position.Y, sprite.position.Y + sprite.size.Y);
+                float y1 = HMM_MAX(sprite.position.Y, sprite.position.Y + sprite.size.Y);
+                if (x1 < min.X || x0 > max.X || y1 < min.Y || y0 > max.Y)
+                {
+                    continue;
+                }
+
+                out.push_back(id);
+            }
+        }
+    }
+
+    // Keep a stable draw order regardless of which cells the sprites came from
+    std::sort(out.begin() + first, out.end());
+}
@@ -0,0 +1,60 @@
+#pragma once
+#ifndef SPRITE_LAYER_HPP
+#define SPRITE_LAYER_HPP
+
+#include <cstdint>
+#include <vector>
+#include "math_types.hpp"
+
+typedef uint32_t SpriteId;
+constexpr SpriteId InvalidSpriteId = UINT32_MAX;
+
+struct Sprite{
+    Vector2 position;
+    Vector2 size;
+    Color color;
+    uint8_t texture = UINT8_MAX;
+    Vector4 uv = {0, 0, 1, 1};
+    float depth = 0;
+};
+
+// Retained sprites bucketed into a uniform grid so only the cells overlapping
+// a query rectangle are visited. Sprites outside the grid bounds are clamped
+// into the border cells, so the grid only needs to cover the common case.
+class SpriteLayer
+{
+private:
+    struct Entry{
+        Sprite sprite;
+        int cellMinX, cellMinY, cellMaxX, cellMaxY;
+        uint32_t queryStamp;
+        bool alive;
+    };
+
+    Vector2 origin;
+    float cellSize;
+    int cellsX, cellsY;
+
+    std::vector<Entry> entries;
+    std::vector<SpriteId> freeIds;
+    std::vector<std::vector<SpriteId>> cells;
+    uint32_t queryStamp = 0;
+
+    void Link(SpriteId id);
+    void Unlink(SpriteId id);
+    void GetCellRange(const Sprite& sprite, int& minX, int& minY, int& maxX, int& maxY) const;
+public:
+
+    void Initialize(Vector2 worldMin, Vector2 worldSize, float cellSize);
+    void Clear();
+
+    SpriteId Add(const Sprite& sprite);
+    void Update(SpriteId id, const Sprite& sprite);
+    void Remove(SpriteId id);
+    const Sprite& Get(SpriteId id) const;
+
+    // Appends the ids of all sprites overlapping [min, max] to out, sorted by id
+    void Query(Vector2 min, Vector2 max, std::vector<SpriteId>& out);
+};
+
+#endif // SPRITE_LAYER_HPP
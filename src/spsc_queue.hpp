@@ -0,0 +1,49 @@
+#pragma once
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// Fixed size lock-free queue for exactly one producer thread and one consumer thread.
+// Push fails instead of blocking when the queue is full
+template<typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    T items[Capacity];
+    // Both only ever grow, the slot is the index masked by the capacity.
+    // Kept on separate cache lines so the two threads don't fight over them
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+public:
+    // Producer only
+    bool Push(const T& item)
+    {
+        size_t write = tail.load(std::memory_order_relaxed);
+        if (write - head.load(std::memory_order_acquire) >= Capacity)
+        {
+            return false;
+        }
+        items[write & (Capacity - 1)] = item;
+        tail.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    bool Pop(T& item)
+    {
+        size_t read = head.load(std::memory_order_relaxed);
+        if (read == tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        item = items[read & (Capacity - 1)];
+        head.store(read + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+#endif // SPSC_QUEUE_HPP
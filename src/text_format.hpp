@@ -0,0 +1,181 @@
+#pragma once
+#ifndef TEXT_FORMAT_HPP
+#define TEXT_FORMAT_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+// Format strings for Renderer::DrawTextFormat, parsed and checked against the argument types at compile time.
+//   {}      next argument, integers, floats or strings
+//   {:.N}   float with N digits after the point, 0 to 9, floats default to 2
+//   {{ }}   literal braces
+
+enum class FormatArgKind : uint8_t{
+    Signed,
+    Unsigned,
+    Float,
+    String,
+};
+
+struct FormatArg{
+    FormatArgKind kind;
+    union{
+        int64_t i;
+        uint64_t u;
+        double f;
+        const char* s;
+    };
+};
+
+constexpr int MaxFormatSegments = 16;
+constexpr int DefaultFloatPrecision = 2;
+
+// A run of literal text, or one argument when argIndex isn't negative
+struct FormatSegment{
+    uint16_t begin;
+    uint16_t length;
+    int8_t argIndex;
+    int8_t precision;
+};
+
+template<typename T>
+consteval FormatArgKind FormatArgKindOf()
+{
+    using Type = std::remove_cvref_t<T>;
+    static_assert(!std::is_same_v<Type, bool> && !std::is_same_v<Type, char>, "Format bools and chars as integers");
+    if constexpr (std::is_floating_point_v<Type>)
+    {
+        return FormatArgKind::Float;
+    }
+    else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+    {
+        return FormatArgKind::Signed;
+    }
+    else if constexpr (std::is_integral_v<Type>)
+    {
+        return FormatArgKind::Unsigned;
+    }
+    else
+    {
+        static_assert(std::is_convertible_v<Type, const char*>, "Only integers, floats and strings can be formatted");
+        return FormatArgKind::String;
+    }
+}
+
+template<typename T>
+constexpr FormatArg MakeFormatArg(const T& value)
+{
+    constexpr FormatArgKind kind = FormatArgKindOf<T>();
+    FormatArg arg = {.kind = kind};
+    if constexpr (kind == FormatArgKind::Float)
+    {
+        arg.f = static_cast<double>(value);
+    }
+    else if constexpr (kind == FormatArgKind::Signed)
+    {
+        arg.i = static_cast<int64_t>(value);
+    }
+    else if constexpr (kind == FormatArgKind::Unsigned)
+    {
+        arg.u = static_cast<uint64_t>(value);
+    }
+    else
+    {
+        arg.s = value;
+    }
+    return arg;
+}
+
+// Not constexpr on purpose, calling it while parsing turns a bad format string into a compile error naming it
+inline void TextFormatError(const char*) {}
+
+template<typename... Args>
+struct TextFormat{
+    const char* text;
+    FormatSegment segments[MaxFormatSegments] = {};
+    int segmentCount = 0;
+
+    consteval TextFormat(const char* format) : text(format)
+    {
+        constexpr FormatArgKind kinds[] = {FormatArgKindOf<Args>()..., FormatArgKind::String};
+        int argCount = 0;
+        int literalBegin = 0;
+        int i = 0;
+
+        auto addSegment = [&](int begin, int length, int argIndex, int precision) {
+            if (segmentCount >= MaxFormatSegments)
+            {
+                TextFormatError("Too many segments in the format string");
+            }
+            segments[segmentCount++] = {static_cast<uint16_t>(begin), static_cast<uint16_t>(length),
+                                        static_cast<int8_t>(argIndex), static_cast<int8_t>(precision)};
+        };
+        auto flushLiteral = [&](int end) {
+            if (end > literalBegin)
+            {
+                addSegment(literalBegin, end - literalBegin, -1, 0);
+            }
+        };
+
+        while (format[i] != '\0')
+        {
+            char c = format[i];
+            if ((c == '{' && format[i + 1] == '{') || (c == '}' && format[i + 1] == '}'))
+            {
+                // Keep one brace of the pair as literal text
+                flushLiteral(i + 1);
+                i += 2;
+                literalBegin = i;
+                continue;
+            }
+            if (c == '}')
+            {
+                TextFormatError("Unmatched } in the format string, use }} for a brace");
+            }
+            if (c != '{')
+            {
+                i++;
+                continue;
+            }
+
+            flushLiteral(i);
+            i++;
+
+            int precision = -1;
+            if (format[i] == ':')
+            {
+                if (format[i + 1] != '.' || format[i + 2] < '0' || format[i + 2] > '9')
+                {
+                    TextFormatError("Only {:.N} with a single digit N is supported");
+                }
+                precision = format[i + 2] - '0';
+                i += 3;
+            }
+            if (format[i] != '}')
+            {
+                TextFormatError("Unterminated placeholder in the format string");
+            }
+            i++;
+
+            if (argCount >= static_cast<int>(sizeof...(Args)))
+            {
+                TextFormatError("More placeholders than arguments");
+            }
+            if (precision >= 0 && kinds[argCount] != FormatArgKind::Float)
+            {
+                TextFormatError("Precision is only allowed for floats");
+            }
+            addSegment(0, 0, argCount, precision >= 0 ? precision : DefaultFloatPrecision);
+            argCount++;
+            literalBegin = i;
+        }
+        flushLiteral(i);
+
+        if (argCount != static_cast<int>(sizeof...(Args)))
+        {
+            TextFormatError("More arguments than placeholders");
+        }
+    }
+};
+
+#endif // TEXT_FORMAT_HPP
@@ -0,0 +1,170 @@
+#include "text_layout_cache.hpp"
+#include <cassert>
+#include <cstring>
+
+static uint64_t HashText(const char* text, size_t length)
+{
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= static_cast<uint8_t>(text[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static uint64_t MakeKey(uint64_t textHash, Font font, FontAlignment alignment)
+{
+    uint64_t style = (static_cast<uint64_t>(font.id) << 24) | (static_cast<uint64_t>(font.pixelHeight & 0xFFFF) << 8) | static_cast<uint64_t>(alignment);
+    // Mix the style in so the same string in different fonts spreads across buckets
+    return textHash ^ (style * 0x9E3779B97F4A7C15ull);
+}
+
+GlyphPlacer::GlyphPlacer(GlyphCache& glyphs, Font font)
+    : glyphs(glyphs), font(font)
+{
+    // Distance field glyphs come back at their stored height and are scaled to the requested one
+    bool distanceField = glyphs.GetMode(font.id) == FontMode::DistanceField;
+    scale = distanceField ? static_cast<float>(font.pixelHeight) / SdfPixelHeight : 1.f;
+    texture = distanceField ? 1 : 0;
+}
+
+GlyphPlacement GlyphPlacer::Place(uint32_t codepoint, LayoutGlyph& placed)
+{
+    Glyph glyph;
+    uint32_t handle;
+    if (!glyphs.GetGlyph(font.id, font.pixelHeight, codepoint, glyph, &handle))
+    {
+        return GlyphPlacement::Failed;
+    }
+
+    float x = advance;
+    advance += glyph.xadvance * scale;
+    if (glyph.x1 <= glyph.x0)
+    {
+        return GlyphPlacement::Empty;
+    }
+
+    // Read after GetGlyph, which may have grown the atlas
+    float atlasScaleX = 1.f / glyphs.GetAtlasWidth();
+    float atlasScaleY = 1.f / glyphs.GetAtlasHeight();
+    placed = {
+        .offset = {x + glyph.xoff * scale, glyph.yoff * scale},
+        .size = {(glyph.xoff2 - glyph.xoff) * scale, (glyph.yoff2 - glyph.yoff) * scale},
+        .uv = {glyph.x0 * atlasScaleX, glyph.y0 * atlasScaleY, glyph.x1 * atlasScaleX, glyph.y1 * atlasScaleY},
+        .handle = handle,
+        .texture = texture,
+    };
+    return GlyphPlacement::Placed;
+}
+
+void TextLayoutCache::Build(GlyphCache& glyphs, Font font, const char* text, FontAlignment alignment, Entry& entry)
+{
+    TextLayout& layout = entry.layout;
+    layout.glyphs.clear();
+    entry.complete = true;
+
+    GlyphPlacer placer(glyphs, font);
+    while (*text != '\0')
+    {
+        LayoutGlyph placed;
+        switch (placer.Place(DecodeUTF8(text), placed))
+        {
+        case GlyphPlacement::Placed:
+            layout.glyphs.push_back(placed);
+            break;
+        case GlyphPlacement::Failed:
+            entry.complete = false;
+            break;
+        case GlyphPlacement::Empty:
+            break;
+        }
+    }
+
+    float advance = placer.GetAdvance();
+
+    layout.width = advance;
+
+    float shift = 0.f;
+    switch (alignment)
+    {
+    case FontAlignment::Left:
+        break;
+    case FontAlignment::Center:
+        shift = -advance * 0.5f;
+        break;
+    case FontAlignment::Right:
+        shift = -advance;
+        break;
+    default:
+        assert(true && "Invalid text alignment value");
+        break;
+    }
+
+    for (LayoutGlyph& layoutGlyph : layout.glyphs)
+    {
+        layoutGlyph.offset.X += shift;
+    }
+}
+
+const TextLayout& TextLayoutCache::Get(GlyphCache& glyphs, Font font, const char* text, FontAlignment alignment)
+{
+    size_t length = strlen(text);
+    uint64_t key = MakeKey(HashText(text, length), font, alignment);
+
+    auto [found, inserted] = entries.try_emplace(key);
+    Entry& entry = found->second;
+    entry.lastUsedFrame = frame;
+
+    // The stored string guards against hash collisions, a colliding string just takes over the slot
+    bool valid = !inserted && entry.complete && entry.generation == glyphs.GetGeneration() &&
+                 entry.text.size() == length && memcmp(entry.text.data(), text, length) == 0;
+    if (valid)
+    {
+        // Keep the glyphs from being evicted while the layout still points at them
+        for (const LayoutGlyph& layoutGlyph : entry.layout.glyphs)
+        {
+            glyphs.Touch(layoutGlyph.handle);
+        }
+        hits++;
+        return entry.layout;
+    }
+
+    misses++;
+    entry.text.assign(text, length);
+    int atlasWidth = glyphs.GetAtlasWidth();
+    int atlasHeight = glyphs.GetAtlasHeight();
+    Build(glyphs, font, text, alignment, entry);
+    // Glyphs placed before the atlas grew have stale texture coordinates. All of them are resident
+    // and in use now, so the second build can't grow it again
+    if (glyphs.GetAtlasWidth() != atlasWidth || glyphs.GetAtlasHeight() != atlasHeight)
+    {
+        Build(glyphs, font, text, alignment, entry);
+    }
+    // Building may have evicted glyphs, the layout only describes the atlas as it is now
+    entry.generation = glyphs.GetGeneration();
+    return entry.layout;
+}
+
+void TextLayoutCache::EndFrame()
+{
+    for (auto it = entries.begin(); it != entries.end();)
+    {
+        bool stale = frame - it->second.lastUsedFrame > MaxIdleFrames;
+        bool overBudget = entries.size() > MaxLayouts && it->second.lastUsedFrame != frame;
+        if (stale || overBudget)
+        {
+            it = entries.erase(it);
+            continue;
+        }
+        ++it;
+    }
+
+    frame++;
+}
+
+void TextLayoutCache::Clear()
+{
+    entries.clear();
+}
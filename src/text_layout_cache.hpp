@@ -0,0 +1,102 @@
+#pragma once
+#ifndef TEXT_LAYOUT_CACHE_HPP
+#define TEXT_LAYOUT_CACHE_HPP
+
+#include <cstdint>
+#include "math_types.hpp"
+#include "glyph_cache.hpp"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class FontAlignment{
+    Left,
+    Center,
+    Right,
+};
+
+struct LayoutGlyph{
+    // Top left corner relative to the text origin, alignment already applied
+    Vector2 offset;
+    Vector2 size;
+    Vector4 uv;
+    uint32_t handle;
+    // Vertex::textureIndex the quad is drawn with, see quad_uv.glsl
+    uint8_t texture;
+};
+
+struct TextLayout{
+    std::vector<LayoutGlyph> glyphs;
+    float width;
+};
+
+enum class GlyphPlacement{
+    Placed,
+    // Nothing to draw, like a space, the pen still moved
+    Empty,
+    // The atlas had no room, the glyph is skipped
+    Failed,
+};
+
+// Walks a pen along the baseline placing glyphs of one font, shared by the layout cache
+// and code that places glyphs without going through a string
+class GlyphPlacer
+{
+private:
+    GlyphCache& glyphs;
+    Font font;
+    float scale;
+    uint8_t texture;
+    float advance = 0.f;
+public:
+    GlyphPlacer(GlyphCache& glyphs, Font font);
+
+    // Offsets are relative to where the pen started
+    GlyphPlacement Place(uint32_t codepoint, LayoutGlyph& placed);
+    float GetAdvance() const { return advance; }
+};
+
+struct TextLayoutStats{
+    uint64_t hits;
+    uint64_t misses;
+    size_t layouts;
+};
+
+// Remembers the positioned glyphs of strings drawn before, so static text is laid out once
+// and later draws only translate and copy the quads. Layouts are keyed by
+// (string hash, font, alignment) and rebuilt when the glyph atlas generation changes,
+// which covers glyph eviction and font reloads.
+class TextLayoutCache
+{
+private:
+    struct Entry{
+        std::string text;
+        TextLayout layout;
+        uint32_t generation;
+        uint32_t lastUsedFrame;
+        // Layouts that could not get all their glyphs this frame are rebuilt on the next lookup
+        bool complete;
+    };
+
+    std::unordered_map<uint64_t, Entry> entries;
+    uint32_t frame = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    static void Build(GlyphCache& glyphs, Font font, const char* text, FontAlignment alignment, Entry& entry);
+public:
+    // Frames an unused layout survives before it is dropped
+    static constexpr uint32_t MaxIdleFrames = 120;
+    // Past this many layouts anything not used this frame is dropped, covers text that changes every frame
+    static constexpr size_t MaxLayouts = 256;
+
+    // The returned layout stays valid until the next EndFrame or Clear
+    const TextLayout& Get(GlyphCache& glyphs, Font font, const char* text, FontAlignment alignment);
+
+    void EndFrame();
+    void Clear();
+
+    TextLayoutStats GetStats() const { return {hits, misses, entries.size()}; }
+};
+
+#endif // TEXT_LAYOUT_CACHE_HPP
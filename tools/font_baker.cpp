@@ -0,0 +1,232 @@
+// Offline font baker, writes the atlas pixels and glyph metrics GlyphCache::LoadBakedFont maps at startup.
+//
+//   font_baker <font.ttf> <output.fontbin> [--sdf | --size <pixels>]
+//
+// Glyphs are rasterized exactly like GlyphCache::Rasterize does at runtime and packed
+// into the top rows of pages of the atlas.
+#include "baked_font.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "stb_rect_pack.h"
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "stb_truetype.h"
+
+// Must match GlyphCache
+constexpr int AtlasSize = 1024;
+constexpr int PageSize = 128;
+
+// Printable ASCII and Latin-1, what the UI draws without going back to the ttf
+constexpr uint32_t BakedRanges[][2] = {
+    {0x20, 0x7E},
+    {0xA0, 0xFF},
+};
+
+struct BakeGlyph{
+    uint32_t codepoint;
+    int width, height;
+    int xoff, yoff;
+    float xadvance;
+    unsigned char* bitmap;
+};
+
+static std::vector<unsigned char> ReadFile(const char* path)
+{
+    std::vector<unsigned char> data;
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return data;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data.resize(size > 0 ? size : 0);
+    if (fread(data.data(), 1, data.size(), file) != data.size())
+    {
+        data.clear();
+    }
+    fclose(file);
+    return data;
+}
+
+static void PrintUsage()
+{
+    fprintf(stderr, "usage: font_baker <font.ttf> <output.fontbin> [--sdf | --size <pixels>]\n");
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    FontMode mode = FontMode::Coverage;
+    int pixelHeight = 64;
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--sdf") == 0)
+        {
+            mode = FontMode::DistanceField;
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            pixelHeight = atoi(argv[++i]);
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (mode == FontMode::DistanceField)
+    {
+        pixelHeight = SdfPixelHeight;
+    }
+    if (pixelHeight <= 0 || pixelHeight > UINT16_MAX)
+    {
+        fprintf(stderr, "invalid pixel height %d\n", pixelHeight);
+        return 1;
+    }
+
+    std::vector<unsigned char> ttf = ReadFile(argv[1]);
+    stbtt_fontinfo info;
+    if (ttf.empty() || !stbtt_InitFont(&info, ttf.data(), stbtt_GetFontOffsetForIndex(ttf.data(), 0)))
+    {
+        fprintf(stderr, "could not load %s\n", argv[1]);
+        return 1;
+    }
+
+    float scale = stbtt_ScaleForPixelHeight(&info, static_cast<float>(pixelHeight));
+
+    std::vector<BakeGlyph> glyphs;
+    for (const auto& range : BakedRanges)
+    {
+        for (uint32_t codepoint = range[0]; codepoint <= range[1]; codepoint++)
+        {
+            int glyphIndex = stbtt_FindGlyphIndex(&info, static_cast<int>(codepoint));
+            // Missing codepoints stay out of the bake, the runtime maps them to notdef itself
+            if (glyphIndex == 0)
+            {
+                continue;
+            }
+
+            BakeGlyph glyph = {.codepoint = codepoint};
+            int advance, leftSideBearing;
+            stbtt_GetGlyphHMetrics(&info, glyphIndex, &advance, &leftSideBearing);
+            glyph.xadvance = scale * advance;
+
+            if (mode == FontMode::DistanceField)
+            {
+                constexpr float distanceScale = static_cast<float>(SdfOnEdge) / SdfPadding;
+                glyph.bitmap = stbtt_GetGlyphSDF(&info, scale, glyphIndex, SdfPadding, SdfOnEdge, distanceScale,
+                                                 &glyph.width, &glyph.height, &glyph.xoff, &glyph.yoff);
+            }
+            else
+            {
+                glyph.bitmap = stbtt_GetGlyphBitmap(&info, scale, scale, glyphIndex, &glyph.width, &glyph.height, &glyph.xoff, &glyph.yoff);
+            }
+            if (glyph.bitmap == nullptr)
+            {
+                glyph.width = glyph.height = glyph.xoff = glyph.yoff = 0;
+            }
+            glyphs.push_back(glyph);
+        }
+    }
+
+    // One pixel of padding on the right and bottom keeps linear filtering from bleeding between glyphs
+    std::vector<stbrp_rect> rects(glyphs.size());
+    for (size_t i = 0; i < glyphs.size(); i++)
+    {
+        rects[i] = {.id = static_cast<int>(i), .w = glyphs[i].width + 1, .h = glyphs[i].height + 1};
+    }
+
+    std::vector<stbrp_node> nodes(AtlasSize);
+    stbrp_context packer;
+    stbrp_init_target(&packer, AtlasSize, AtlasSize, nodes.data(), static_cast<int>(nodes.size()));
+    if (!stbrp_pack_rects(&packer, rects.data(), static_cast<int>(rects.size())))
+    {
+        fprintf(stderr, "glyphs don't fit into a %dx%d atlas\n", AtlasSize, AtlasSize);
+        return 1;
+    }
+
+    int usedHeight = 0;
+    for (const stbrp_rect& rect : rects)
+    {
+        if (rect.y + rect.h > usedHeight)
+        {
+            usedHeight = rect.y + rect.h;
+        }
+    }
+    int height = (usedHeight + PageSize - 1) / PageSize * PageSize;
+
+    std::vector<unsigned char> pixels(static_cast<size_t>(AtlasSize) * height, 0);
+    std::vector<BakedGlyph> records(glyphs.size());
+    size_t usedPixels = 0;
+    for (const stbrp_rect& rect : rects)
+    {
+        const BakeGlyph& glyph = glyphs[rect.id];
+        for (int row = 0; row < glyph.height; row++)
+        {
+            memcpy(&pixels[(rect.y + row) * AtlasSize + rect.x], glyph.bitmap + row * glyph.width, glyph.width);
+        }
+        usedPixels += static_cast<size_t>(glyph.width) * glyph.height;
+
+        records[rect.id] = {
+            .codepoint = glyph.codepoint,
+            .x0 = static_cast<uint16_t>(rect.x),
+            .y0 = static_cast<uint16_t>(rect.y),
+            .x1 = static_cast<uint16_t>(rect.x + glyph.width),
+            .y1 = static_cast<uint16_t>(rect.y + glyph.height),
+            .xoff = static_cast<float>(glyph.xoff),
+            .yoff = static_cast<float>(glyph.yoff),
+            .xadvance = glyph.xadvance,
+        };
+        if (mode == FontMode::DistanceField)
+        {
+            stbtt_FreeSDF(glyph.bitmap, nullptr);
+        }
+        else
+        {
+            stbtt_FreeBitmap(glyph.bitmap, nullptr);
+        }
+    }
+
+    BakedFontHeader header = {
+        .magic = BakedFontMagic,
+        .version = BakedFontVersion,
+        .width = AtlasSize,
+        .height = static_cast<uint16_t>(height),
+        .pixelHeight = static_cast<uint16_t>(pixelHeight),
+        .mode = mode,
+        .sdfPadding = SdfPadding,
+        .sdfOnEdge = SdfOnEdge,
+        .glyphCount = static_cast<uint32_t>(records.size()),
+        .sourceSize = static_cast<uint32_t>(ttf.size()),
+    };
+
+    FILE* output = fopen(argv[2], "wb");
+    if (output == nullptr)
+    {
+        fprintf(stderr, "could not open %s for writing\n", argv[2]);
+        return 1;
+    }
+    bool written = fwrite(&header, sizeof(header), 1, output) == 1 &&
+                   fwrite(records.data(), sizeof(BakedGlyph), records.size(), output) == records.size() &&
+                   fwrite(pixels.data(), 1, pixels.size(), output) == pixels.size();
+    fclose(output);
+    if (!written)
+    {
+        fprintf(stderr, "could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("baked %zu glyphs at %dpx into %dx%d, %.1f%% of the region covered\n",
+        records.size(), pixelHeight, AtlasSize, height, 100.0 * usedPixels / pixels.size());
+    return 0;
+}
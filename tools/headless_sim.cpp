@@ -0,0 +1,106 @@
+// Headless simulator, plays matches between two simple AIs with the game's own rules as fast as
+// the CPU allows and reports the tick rate. No window, no GL, no SDL.
+//
+//   headless_sim [matches] [--seed <n>]
+//
+// Useful for evaluating AIs and for load testing the simulation on its own.
+#include "simulation.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+// Ten minutes of game time, rallies that settle into a loop the AIs never miss count as unfinished
+constexpr uint64_t MaxMatchTicks = SimulationTickRate * 60 * 10;
+
+// Follows the ball once it is about a tenth of the field away from the paddle and heading its way,
+// drifts back to the center otherwise. Reacting that late it misses often enough for matches to end
+static Fixed TrackBall(const GameState& game, FixedVector2 paddlePosition, int towards)
+{
+    constexpr Fixed HalfPaddleHeight = FixedFromFloat(gGameParams.paddleSize.Y * 0.5f);
+    constexpr Fixed HalfBallHeight = FixedFromFloat(gGameParams.ballSize.Y * 0.5f);
+    constexpr Fixed ReactionDistance = FixedFromFloat(gGameParams.gameSize.X * 0.35f);
+    // Full speed once the ball is more than a quarter paddle away from the center
+    constexpr Fixed FullInputDistance = FixedFromFloat(gGameParams.paddleSize.Y * 0.25f);
+
+    Fixed paddleCenter = paddlePosition.Y + HalfPaddleHeight;
+    Fixed target = 0;
+    if (game.ballVelocity.X * towards > 0 && game.ballPosition.X * towards > ReactionDistance)
+    {
+        target = game.ballPosition.Y + HalfBallHeight;
+    }
+    return FixedClamp(-FixedOne, FixedDiv(target - paddleCenter, FullInputDistance), FixedOne);
+}
+
+static void PrintUsage()
+{
+    fprintf(stderr, "usage: headless_sim [matches] [--seed <n>]\n");
+}
+
+int main(int argc, char* argv[])
+{
+    int matches = 1000;
+    unsigned int seed = static_cast<unsigned int>(time(NULL));
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (argv[i][0] >= '0' && argv[i][0] <= '9')
+        {
+            matches = atoi(argv[i]);
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    uint64_t ticks = 0;
+    int winsLeft = 0;
+    int winsRight = 0;
+    int unfinished = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int match = 0; match < matches; match++)
+    {
+        // Every match gets its own seed so any one of them can be rerun on its own
+        GameState game = NewGame(seed + match);
+
+        uint64_t matchTicks = 0;
+        // Serving is the start press, both AIs hold it down
+        while (game.state != PONG_END && matchTicks < MaxMatchTicks)
+        {
+            GameInputs inputs = {
+                .left = TrackBall(game, game.paddlePositionLeft, -1),
+                .right = TrackBall(game, game.paddlePositionRight, 1),
+                .start = true,
+            };
+            game = Step(game, inputs);
+            matchTicks++;
+        }
+        ticks += matchTicks;
+
+        if (game.state != PONG_END)
+        {
+            unfinished++;
+        }
+        else if (game.scoreLeft > game.scoreRight)
+        {
+            winsLeft++;
+        }
+        else
+        {
+            winsRight++;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("seed %u, %d matches: left %d, right %d, unfinished %d\n", seed, matches, winsLeft, winsRight, unfinished);
+    printf("%llu ticks in %.3fs, %.0f ticks/s, %.1fx real time\n", (unsigned long long)ticks, seconds,
+        seconds > 0.0 ? ticks / seconds : 0.0, seconds > 0.0 ? ticks * SimulationTickSeconds / seconds : 0.0);
+    return 0;
+}